@@ -0,0 +1,191 @@
+/*
+  ArcRaster.h - annulus sectors filled row by row, for Gauges::fillArc().
+
+  A pixel belongs to the sector when the distance of its centre from x0, y0 rounds to
+  inner..outer and its centre lies within [start, start + sweep) or less than half a pixel
+  outside either end, angles in radians from the positive x axis towards the positive y axis,
+  i.e. clockwise on the screen.  The ends reach half a pixel out as the ring's rounding does,
+  and as the inclusive spans of the triangle tessellation did.  x0, y0 is taken as the top
+  left corner of its pixel, where the truncated vertices of the triangles put the arc on
+  average, so the two agree within a pixel.
+
+  Each row is worked out with integer math only: the ring's extent from the previous row's
+  (a running square root), the angular limits as half planes through the centre, their
+  directions from the sine table (FastTrig.h).  The row is then one to four drawFastHLine()
+  spans, over only the rows the sector reaches.  Only the two boundary directions need a
+  sine and a cosine, where the tessellation needed four per step of the arc.
+
+  The angles are rounded to ARC_TURN units per turn first; fillArcSectorAngles() takes them in
+  those units.  Sectors meeting at the same angle overlap in a strip a pixel wide along it, so
+  they meet without a gap and the one drawn last shows there.
+
+  Out is anything with drawFastHLine(x, y, w, color), TFT_eSPI on the display; the host
+  checks and times it against the triangles (extras/host/ArcRasterBench.cpp).
+*/
+
+#ifndef _ARCRASTER_H_
+#define _ARCRASTER_H_
+
+#include <math.h>
+#include <stdint.h>
+#include "FastTrig.h"
+
+#define ARC_TURN TRIG_TURN // angle units in a full turn
+#define ARC_ONE TRIG_ONE   // length of a boundary direction
+#define ARC_SPAN_MAX 4096  // wider than any row
+
+const float arcTwoPi = 6.28318530718f;
+
+// largest x with (2x + 1)^2 + y2 <= limit, from a guess near it; -1 if there is none
+inline int32_t arcRowExtent(int32_t x, int32_t y2, int32_t limit)
+{
+    if (x < -1)
+        x = -1;
+    while ((2 * x + 3) * (2 * x + 3) + y2 <= limit)
+        x++;
+    while (x >= 0 && (2 * x + 1) * (2 * x + 1) + y2 > limit)
+        x--;
+    return x;
+}
+
+inline int32_t arcFloorDiv(int32_t a, int32_t b) // b > 0
+{
+    return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+// narrows lo..hi on row Y = 2dy + 1 (half pixels) to the side of direction (c, s) at or past
+// its angle (from), or before it (!from), each reaching half a pixel over: the sides are
+// cross(direction, pixel) >= -ARC_ONE and < ARC_ONE, with the pixel's centre at X = 2dx + 1
+inline void arcBound(int32_t c, int32_t s, int32_t Y, bool from, int32_t &lo, int32_t &hi)
+{
+    int32_t num = c * Y - s + (from ? ARC_ONE : -ARC_ONE); // cross +- ARC_ONE is num - 2s * dx
+    if (s == 0)
+    {
+        if ((num >= 0) != from)
+            hi = lo - 1;
+        return;
+    }
+    if (s > 0)
+    {
+        int32_t x = arcFloorDiv(num, 2 * s); // last dx with num - 2s * dx >= 0
+        if (from && x < hi)
+            hi = x;
+        else if (!from && x + 1 > lo)
+            lo = x + 1;
+    }
+    else
+    {
+        int32_t x = -arcFloorDiv(num, -2 * s); // first dx with num - 2s * dx >= 0
+        if (from && x > lo)
+            lo = x;
+        else if (!from && x - 1 < hi)
+            hi = x - 1;
+    }
+}
+
+// the ring inner..outer around x0, y0 over angle units [from, to)
+template <class Out>
+void fillArcSectorAngles(Out &out, int32_t x0, int32_t y0, int32_t inner, int32_t outer, int32_t from, int32_t to,
+                         uint32_t color)
+{
+    if (outer < inner || outer < 0 || to <= from)
+        return;
+    if (inner < 0)
+        inner = 0;
+
+    // at most two intervals once the sector is brought into 0..ARC_TURN
+    bool full = to - from >= ARC_TURN;
+    to -= from;
+    from &= ARC_TURN - 1;
+    to += from;
+    int32_t los[2] = { from, 0 };
+    int32_t his[2] = { to < ARC_TURN ? to : ARC_TURN, to - ARC_TURN };
+    int     count  = full ? 0 : to > ARC_TURN ? 2 : 1;
+
+    int32_t fromC = trigCos(from), fromS = trigSin(from);
+    int32_t toC   = trigCos(to), toS = trigSin(to);
+
+    // in half pixels, from the rounding of the distance
+    int32_t outerLimit = (2 * outer + 1) * (2 * outer + 1);
+    int32_t innerLimit = (2 * inner - 1) * (2 * inner - 1) - 1;
+    int32_t xo = 0, xi = 0;
+
+    // only the rows between the ends of the sector, or its lowest and highest points
+    int32_t top = -outer - 1, bottom = outer;
+    if (!full)
+    {
+        int32_t ys[4] = { fromS * inner, fromS * outer, toS * inner, toS * outer };
+        int32_t lowest = ys[0], highest = ys[0];
+        for (int i = 1; i < 4; i++)
+        {
+            lowest  = ys[i] < lowest ? ys[i] : lowest;
+            highest = ys[i] > highest ? ys[i] : highest;
+        }
+        if (((ARC_TURN / 4 - from) & (ARC_TURN - 1)) >= to - from)
+            bottom = arcFloorDiv(highest, ARC_ONE) + 1;
+        if (((ARC_TURN * 3 / 4 - from) & (ARC_TURN - 1)) >= to - from)
+            top = arcFloorDiv(lowest, ARC_ONE) - 1;
+    }
+
+    for (int32_t dy = top; dy <= bottom; dy++)
+    {
+        int32_t Y = 2 * dy + 1;
+        xo        = arcRowExtent(xo, Y * Y, outerLimit);
+        xi        = inner > 0 ? arcRowExtent(xi, Y * Y, innerLimit) : -1;
+        if (xo < 0)
+            continue;
+
+        // the ring's spans on this row, either side of the corner
+        int32_t ring[2][2] = { { -xo - 1, xi < 0 ? xo : -xi - 2 }, { xi + 1, xo } };
+        int     rings      = xi < 0 ? 1 : 2;
+
+        // the angular spans: the row keeps to one half of the circle, where the angle runs
+        // one way along it and a boundary inside that half is a half plane
+        int32_t spans[2][2];
+        int     angles = 0;
+        if (full)
+        {
+            spans[0][0] = -ARC_SPAN_MAX;
+            spans[0][1] = ARC_SPAN_MAX;
+            angles      = 1;
+        }
+        int32_t halfLo = Y > 0 ? 0 : ARC_TURN / 2;
+        int32_t halfHi = halfLo + ARC_TURN / 2;
+        for (int i = 0; i < count; i++)
+        {
+            if (los[i] >= halfHi || his[i] <= halfLo)
+                continue;
+            int32_t lo = -ARC_SPAN_MAX, hi = ARC_SPAN_MAX;
+            if (los[i] > halfLo)
+                arcBound(fromC, fromS, Y, true, lo, hi);
+            if (his[i] < halfHi)
+                arcBound(toC, toS, Y, false, lo, hi);
+            if (lo <= hi)
+            {
+                spans[angles][0]   = lo;
+                spans[angles++][1] = hi;
+            }
+        }
+
+        for (int r = 0; r < rings; r++)
+            for (int a = 0; a < angles; a++)
+            {
+                int32_t lo = ring[r][0] > spans[a][0] ? ring[r][0] : spans[a][0];
+                int32_t hi = ring[r][1] < spans[a][1] ? ring[r][1] : spans[a][1];
+                if (lo <= hi)
+                    out.drawFastHLine(x0 + lo, y0 + dy, hi - lo + 1, color);
+            }
+    }
+}
+
+// the ring inner..outer around x0, y0 over [start, start + sweep) radians, sweep >= 0
+template <class Out>
+void fillArcSector(Out &out, int32_t x0, int32_t y0, int32_t inner, int32_t outer, float start, float sweep,
+                   uint32_t color)
+{
+    if (sweep > 0)
+        fillArcSectorAngles(out, x0, y0, inner, outer, lroundf(start * (ARC_TURN / arcTwoPi)),
+                            lroundf((start + sweep) * (ARC_TURN / arcTwoPi)), color);
+}
+
+#endif // _ARCRASTER_H_
@@ -0,0 +1,139 @@
+/*
+  FastTrig.h - sine and cosine from a fixed point table built at compile time.
+
+  Angles are binary: TRIG_TURN units to the turn in a uint16_t, so that they wrap by
+  themselves, clockwise on the screen from the positive x axis like the radians they stand
+  for.  The table holds a quarter wave in TRIG_QUARTER_STEPS steps as TRIG_ONE fixed point,
+  generated by the compiler from the sine's series (constexpr, nothing computed at boot),
+  and placed in flash.  trigSin() and trigCos() mirror it into the other quarters and
+  interpolate linearly between entries.
+
+  Error bounds, against the exact sine of the same angle:
+    interpolation between entries     (pi / 2 / 256)^2 / 8 = 4.7e-6
+    entries rounded to TRIG_ONE           0.5 / 32768       = 1.5e-5
+    interpolated step truncated           1 / 32768         = 3.1e-5
+  so trigSin() is within 5.1e-5 of the sine, under 2 units of TRIG_ONE.  fastSin() and
+  fastCos() round a float angle in radians to the nearest unit first, up to 4.8e-5 more: at
+  the display's largest radius of 160 pixels that is 0.02 of a pixel.
+  extras/host/FastTrigBench.cpp checks these over every angle.
+
+      int32_t s = trigSin(trigDegrees(30));        // 16384, i.e. 0.5 * TRIG_ONE
+      float   c = fastCos(roll * DEG_TO_RAD);       // float in, float out
+      fastSinCos(theta, sinTheta, cosTheta);        // both from one angle
+
+  trigLookups() counts the lookups while trigCounting() is set, for the page benchmark.  The
+  test is the same in every file, so the library's lookups count too; it costs a load and a
+  branch per lookup while counting is off.
+*/
+
+#ifndef _FASTTRIG_H_
+#define _FASTTRIG_H_
+
+#include <math.h>
+#include <stdint.h>
+
+#define TRIG_TURN 65536         // angle units in a full turn
+#define TRIG_HALF 32768         // pi
+#define TRIG_QUARTER 16384      // pi / 2
+#define TRIG_QUARTER_STEPS 256  // table entries over a quarter turn, less one
+#define TRIG_STEP_BITS 6        // angle units between entries, log2(TRIG_QUARTER / TRIG_QUARTER_STEPS)
+#define TRIG_ONE 32768          // sine of a quarter turn
+
+// sin(x) by its series, x2 = x * x, for 0 <= x <= pi / 2 (error under 1e-12)
+constexpr double trigSeries(double x2, double term, double sum, int n)
+{
+    return n > 12 ? sum : trigSeries(x2, -term * x2 / ((2 * n) * (2 * n + 1)), sum + term, n + 1);
+}
+
+constexpr uint16_t trigEntryAt(double x)
+{
+    return uint16_t(trigSeries(x * x, x, 0.0, 1) * TRIG_ONE + 0.5);
+}
+
+constexpr uint16_t trigEntry(int k)
+{
+    return trigEntryAt(k * (3.14159265358979323846 / 2 / TRIG_QUARTER_STEPS));
+}
+
+// the entries for 0..K, with one past the quarter so that interpolation needs no test
+template <int... K> struct TrigTable
+{
+    static constexpr uint16_t sine[sizeof...(K)] = { trigEntry(K)... };
+};
+template <int... K> constexpr uint16_t TrigTable<K...>::sine[sizeof...(K)];
+
+template <int N, int... K> struct TrigTableOf : TrigTableOf<N - 1, N - 1, K...>
+{
+};
+template <int... K> struct TrigTableOf<0, K...> : TrigTable<K...>
+{
+};
+
+typedef TrigTableOf<TRIG_QUARTER_STEPS + 2> TrigQuarter;
+
+static_assert(TrigQuarter::sine[0] == 0 && TrigQuarter::sine[TRIG_QUARTER_STEPS] == TRIG_ONE,
+              "the sine table must run from 0 to TRIG_ONE");
+
+// table lookups are counted while set
+inline bool &trigCounting()
+{
+    static bool counting = false;
+    return counting;
+}
+
+// table lookups counted so far
+inline uint32_t &trigLookups()
+{
+    static uint32_t lookups = 0;
+    return lookups;
+}
+
+// sine in TRIG_ONE fixed point
+inline int32_t trigSin(uint16_t angle)
+{
+    if (trigCounting())
+        trigLookups()++;
+    uint16_t i = angle & (TRIG_QUARTER - 1);
+    if (angle & TRIG_QUARTER)
+        i = TRIG_QUARTER - i; // the second and fourth quarters run back
+    uint16_t k    = i >> TRIG_STEP_BITS;
+    int32_t  f    = i & ((1 << TRIG_STEP_BITS) - 1);
+    int32_t  from = TrigQuarter::sine[k];
+    int32_t  v    = from + (((TrigQuarter::sine[k + 1] - from) * f) >> TRIG_STEP_BITS);
+    return angle & TRIG_HALF ? -v : v;
+}
+
+inline int32_t trigCos(uint16_t angle)
+{
+    return trigSin(angle + TRIG_QUARTER);
+}
+
+// the nearest angle unit to radians, or to degrees
+inline uint16_t trigAngle(float radians)
+{
+    return (uint16_t)(int32_t)lroundf(radians * (TRIG_TURN / 6.28318530718f));
+}
+
+inline uint16_t trigDegrees(float degrees)
+{
+    return (uint16_t)(int32_t)lroundf(degrees * (TRIG_TURN / 360.0f));
+}
+
+inline float fastSin(float radians)
+{
+    return trigSin(trigAngle(radians)) * (1.0f / TRIG_ONE);
+}
+
+inline float fastCos(float radians)
+{
+    return trigCos(trigAngle(radians)) * (1.0f / TRIG_ONE);
+}
+
+inline void fastSinCos(float radians, float &s, float &c)
+{
+    uint16_t angle = trigAngle(radians);
+    s              = trigSin(angle) * (1.0f / TRIG_ONE);
+    c              = trigCos(angle) * (1.0f / TRIG_ONE);
+}
+
+#endif // _FASTTRIG_H_
@@ -62,7 +62,10 @@ OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
     See GaugeWidgets.h file for a complete listing of library variables.
 */
 
+#include <stddef.h>
+#include <string.h>
 #include "GaugeWidgets.h"
+#include "ArcRaster.h"
 #define GFXFF 1
 //#define ARCSTEP 0.00872664626f     // Smaller steps for more arc accuracy, larger steps for faster execution for arc gauges.
 #define ARCSTEP 0.01745329252f   
@@ -73,9 +76,12 @@ OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 const uint16_t LOG_SCALEUP = 12;   // 4096
 const uint16_t SCALEUP = pow(2, LOG_SCALEUP);   // upscaling integer math routines prevents significant rounding errors.
 
-extern TFT_eSprite gdraw;
+extern TFT_eSprite &gdraw;
 
-Gauges::Gauges() {}
+Gauges::Gauges() : gaugeStale(true), arcStep(ARCSTEP), arcScanline(true), arcCacheUses(0), gaugeKey(0) {
+  for (int16_t i = 0; i < ARC_GRAPH_CACHE; i++) arcCache[i].key = 0;
+  memset (&gaugeParams, 0, sizeof(gaugeParams));
+}
 
 //
 // Draw cartesian lines
@@ -91,6 +97,14 @@ void Gauges::drawLine (int16_t x0, int16_t y0, int16_t x1, int16_t y1,
   fillLine (x0, y0, x1, y1, lineColor, lineWidth, lineEnd, edgeColor, edgeWidth, edgeEnd);
 }
 
+// Sine and cosine of the direction from one point to another, by normalizing rather than atan2
+static void lineDirection (float dx, float dy, float &sinA, float &cosA){
+  float length = sqrtf (dx * dx + dy * dy);
+  if (length == 0) { sinA = 0; cosA = 1; return; }
+  sinA = dy / length;
+  cosA = dx / length;
+}
+
 // Fill line 
 void Gauges::fillLine (int16_t x0, int16_t y0, int16_t x1, int16_t y1, 
                        uint16_t lineColor, 
@@ -101,9 +115,10 @@ void Gauges::fillLine (int16_t x0, int16_t y0, int16_t x1, int16_t y1,
   if (lineWidth == 1) gdraw.drawLine (x0, y0, x1, y1, lineColor);     
   
   else if (lineWidth > 1){
-    float angle = atan2 (y1 - y0, x1 - x0);
-    float sinA = (lineWidth / 2) * sin (angle);
-    float cosA = (lineWidth / 2) * cos (angle);
+    float sinA, cosA;
+    lineDirection (x1 - x0, y1 - y0, sinA, cosA);
+    sinA *= lineWidth / 2;
+    cosA *= lineWidth / 2;
 
     int16_t px3 = x0 + sinA; // - cosA; 
     int16_t py3 = y0 - cosA; // - sinA;
@@ -168,9 +183,10 @@ void Gauges::drawEdge (int16_t x0, int16_t y0, int16_t x1, int16_t y1,
   if (edgeWidth == 1) gdraw.drawLine (x0, y0, x1, y1, edgeColor);    
   
   else if (edgeWidth > 1){
-    float angle = atan2 (y1 - y0, x1 - x0);
-    float sinA = (edgeWidth / 2) * sin (angle);
-    float cosA = (edgeWidth / 2) * cos (angle);
+    float sinA, cosA;
+    lineDirection (x1 - x0, y1 - y0, sinA, cosA);
+    sinA *= edgeWidth / 2;
+    cosA *= edgeWidth / 2;
 
     int16_t px3 = x0 + sinA; // - cosA; 
     int16_t py3 = y0 - cosA; // - sinA;
@@ -383,6 +399,14 @@ void Gauges::fillArc (int16_t x0, int16_t y0, int16_t radius,
                       uint16_t edgeColor, uint16_t edgeWidth, 
                       uint8_t edgeEnd) {
 
+  if (arcScanline) {
+    // Both ends rounded to units, so that arcs meeting at the same angle still meet exactly.
+    int32_t from = lroundf(startAngle * (TRIG_TURN / TWO_PI));
+    int32_t to = lroundf((startAngle + arcAngle) * (TRIG_TURN / TWO_PI));
+    fillArc16 (x0, y0, radius, from, to - from, lineColor, lineWidth, edgeColor, edgeWidth, edgeEnd);
+    return;
+  }
+
   float cosA;  
   float sinA;  
   float cosB;          
@@ -394,22 +418,23 @@ void Gauges::fillArc (int16_t x0, int16_t y0, int16_t radius,
   int16_t x4 = 0, y4 = 0; 
   int16_t nx1 = 0, ny1 = 0, nx2 = 0, ny2 = 0;
   
-  for (float j = 0; j < abs(arcAngle); j += ARCSTEP) {
+  for (float j = 0; j < abs(arcAngle); j += arcStep) {
           
     float theta = startAngle + j;
+    float step = (abs(arcAngle) - j < arcStep) ? abs(arcAngle) - j : arcStep;   // coarse steps must not run past the end of the arc
     
     if (arcAngle >= 0) {
-      cosA = cos(theta);
-      sinA = sin(theta);
-      cosB = cos(theta + ARCSTEP);
-      sinB = sin(theta + ARCSTEP);
+      cosA = fastCos(theta);
+      sinA = fastSin(theta);
+      cosB = fastCos(theta + step);
+      sinB = fastSin(theta + step);
     }
     
     else { // counterClockwise
-      cosA = -cos(theta);
-      sinA =  sin(theta);
-      cosB = -cos(theta - ARCSTEP);
-      sinB =  sin(theta - ARCSTEP);
+      cosA = -fastCos(theta);
+      sinA =  fastSin(theta);
+      cosB = -fastCos(theta - step);
+      sinB =  fastSin(theta - step);
     }
      
     int16_t LW2 = lineWidth/2;
@@ -441,6 +466,43 @@ void Gauges::fillArc (int16_t x0, int16_t y0, int16_t radius,
   }
 }
 
+void Gauges::drawArc16 (int16_t x0, int16_t y0, int16_t radius,
+                        uint16_t startAngle, int32_t arcAngle, 
+                        uint16_t lineColor, uint16_t lineWidth, 
+                        uint16_t edgeColor, uint16_t edgeWidth, 
+                        uint8_t edgeEnd) {
+  fillArc16 (x0, y0, radius, startAngle, arcAngle, lineColor, lineWidth, edgeColor, edgeWidth, edgeEnd);
+}                        
+
+void Gauges::fillArc16 (int16_t x0, int16_t y0, int16_t radius,
+                        uint16_t startAngle, int32_t arcAngle, 
+                        uint16_t lineColor, uint16_t lineWidth, 
+                        uint16_t edgeColor, uint16_t edgeWidth, 
+                        uint8_t edgeEnd) {
+
+  // Counterclockwise arcs are mirrored about the vertical, the same ring from the other side.
+  int32_t sweep = abs(arcAngle);
+  int32_t from = (arcAngle >= 0) ? startAngle : TRIG_HALF - startAngle - sweep;
+  int16_t LW2 = lineWidth/2;
+  
+  if (lineColor != NOFILL) fillArcSectorAngles (gdraw, x0, y0, radius - LW2, radius + LW2, from, from + sweep, lineColor);
+  
+  if (edgeWidth != 0 && sweep > 0) {
+    int16_t EW2 = (edgeWidth - 1)/2;
+    fillArcSectorAngles (gdraw, x0, y0, radius + LW2 - EW2, radius + LW2 - EW2 + edgeWidth - 1, from, from + sweep, edgeColor);
+    fillArcSectorAngles (gdraw, x0, y0, radius - LW2 - EW2, radius - LW2 - EW2 + edgeWidth - 1, from, from + sweep, edgeColor);
+    
+    if (sweep < TRIG_TURN) {
+      float cosA = trigCos (from) * (1.0f / TRIG_ONE), sinA = trigSin (from) * (1.0f / TRIG_ONE);
+      float cosB = trigCos (from + sweep) * (1.0f / TRIG_ONE), sinB = trigSin (from + sweep) * (1.0f / TRIG_ONE);
+      drawEdge (x0 + (radius + LW2) * cosA, y0 + (radius + LW2) * sinA, x0 + (radius - LW2) * cosA, y0 + (radius - LW2) * sinA, 
+                edgeColor, edgeWidth, edgeEnd);
+      drawEdge (x0 + (radius + LW2) * cosB, y0 + (radius + LW2) * sinB, x0 + (radius - LW2) * cosB, y0 + (radius - LW2) * sinB, 
+                edgeColor, edgeWidth, edgeEnd);
+    }
+  }
+}
+
 // 
 // Draw graduation marks in an arc. Marks are always drawn radially.
 // 
@@ -465,8 +527,8 @@ void Gauges::gradMarkArc (int16_t x0, int16_t y0, int16_t radius, float startAng
      double gradStep = arcAngle/gradMarks;
      
      for (int16_t j = 0; j <= abs(gradMarks); j++) {
-       cosA = cos (j * gradStep + startAngle);
-       sinA = sin (j * gradStep + startAngle);
+       cosA = fastCos (j * gradStep + startAngle);
+       sinA = fastSin (j * gradStep + startAngle);
                          
        int16_t ax1 = x0 + (radius - 0.5f * gradMajorLength) * cosA;
        int16_t ay1 = y0 + (radius - 0.5f * gradMajorLength) * sinA;
@@ -478,8 +540,8 @@ void Gauges::gradMarkArc (int16_t x0, int16_t y0, int16_t radius, float startAng
 
    for (int16_t j = 0; j < abs(gradMarks); j++) {
 
-       cosA = cos(j * gradStep + startAngle + 0.5f * gradStep);
-       sinA = sin(j * gradStep + startAngle + 0.5f * gradStep);
+       cosA = fastCos(j * gradStep + startAngle + 0.5f * gradStep);
+       sinA = fastSin(j * gradStep + startAngle + 0.5f * gradStep);
                          
        int16_t ax1 = x0 + (radius - 0.5f * gradMinorLength) * cosA;
        int16_t ay1 = y0 + (radius - 0.5f * gradMinorLength) * sinA;
@@ -501,6 +563,7 @@ void Gauges::gradMarkArc (int16_t x0, int16_t y0, int16_t radius, float startAng
 void Gauges::setPointer (uint8_t Num, int16_t Value, uint8_t Type, uint16_t color, char Tag) {
 
   if (Num >= 1 && Num <= NUM_POINTERS) {
+    if (pointerValue[Num] != Value || pointerType[Num] != Type || pointerColor[Num] != color || pointerTag[Num] != Tag) gaugeStale = true;
     pointerValue[Num] = Value;
     pointerType [Num] = Type;
     pointerColor [Num] = color;
@@ -509,17 +572,13 @@ void Gauges::setPointer (uint8_t Num, int16_t Value, uint8_t Type, uint16_t colo
 }
 
 void Gauges::clearPointers(){
-  for (int16_t i = 1; i <= NUM_POINTERS; i++) {
-    pointerValue [i] = 0;
-    pointerType [i] = 0;
-    pointerColor [i] = 0;
-    pointerTag [i] = '\0';
-  }
+  for (int16_t i = 1; i <= NUM_POINTERS; i++) setPointer (i, 0, 0, 0, '\0');
 }
   
 void Gauges::setRange (uint8_t Num, bool Valid, int16_t Top, int16_t Bottom, uint16_t color) {
 
   if (Num >= 1 && Num <= NUM_RANGES) { 
+    if (rangeValid[Num] != Valid || rangeTop[Num] != Top || rangeBot[Num] != Bottom || rangeColor[Num] != color) gaugeStale = true;
     rangeValid[Num] = Valid;
     rangeTop[Num] = Top;
     rangeBot[Num] = Bottom;
@@ -528,20 +587,18 @@ void Gauges::setRange (uint8_t Num, bool Valid, int16_t Top, int16_t Bottom, uin
 }
 
 void Gauges::clearRanges(){
-  for (int16_t i = 1; i <= NUM_RANGES; i++) {
-    rangeValid[i] = false;
-    rangeTop[i] = 0;
-    rangeBot[i] = 0;
-    rangeColor[i] = 0;
-  }
+  for (int16_t i = 1; i <= NUM_RANGES; i++) setRange (i, false, 0, 0, 0);
 }
 
 void Gauges::setGradMarks (int16_t gMarks){
+ if (gradMarks != gMarks) gaugeStale = true;
  gradMarks = gMarks;
  }
 
 void Gauges::setGradMarks(uint16_t MjColor, uint16_t MjLen, uint16_t MjWidth,
                           uint16_t MnColor, uint16_t MnLen, uint16_t MnWidth, uint8_t gLineEnd){
+  if (gradMajorColor != MjColor || gradMajorLength != MjLen || gradMajorWidth != MjWidth ||
+      gradMinorColor != MnColor || gradMinorLength != MnLen || gradMinorWidth != MnWidth || gradLineEnd != gLineEnd) gaugeStale = true;
   gradMajorColor =  MjColor;                    
   gradMajorLength = MjLen;
   gradMajorWidth = MjWidth;
@@ -552,14 +609,8 @@ void Gauges::setGradMarks(uint16_t MjColor, uint16_t MjLen, uint16_t MjWidth,
 }
 
 void Gauges::clearGradMarks(){
-  gradMarks = 0;
-  gradMajorColor =  0;                    
-  gradMajorLength = 0;
-  gradMajorWidth = 0;
-  gradMinorColor =  0;
-  gradMinorLength = 0;  
-  gradMinorWidth = 0;
-  gradLineEnd = 0;
+  setGradMarks (0);
+  setGradMarks (0, 0, 0, 0, 0, 0, 0);
 }
 
 //
@@ -812,19 +863,57 @@ void Gauges::hBarGraph (int16_t x0, int16_t y0, int16_t barSize, int16_t barWidt
   btmDatumY = topDatumY; ;
 }
 
+static_assert (sizeof(ArcGraphKey) == offsetof(ArcGraphKey, args) + sizeof(ArcGraphKey::args),
+               "ArcGraphKey must have no padding to compare with memcmp");
+
+// FNV-1a, for the arc graph cache keys
+static uint32_t gaugeHash (uint32_t hash, const void *data, size_t size){
+  const uint8_t *bytes = (const uint8_t *)data;
+  for (size_t i = 0; i < size; i++) hash = (hash ^ bytes[i]) * 16777619u;
+  return hash;
+}
+
 /*
-   Arc bar graph gauge, both clockwise and counterclockwise.
+   Arc graph geometry that does not depend on the rotation (startAngle), found by its parameters
+   or worked out into the least recently drawn slot.
 */
-void Gauges::arcGraph (int16_t x0, int16_t y0, int16_t barSize, int16_t barWidth, int16_t maxDisplay, int16_t minDisplay,
-                       int16_t startAngle, int16_t arcAngle, bool clockWise, int16_t gradMarks) {
+ArcGraphCache &Gauges::arcGraphGeometry (int16_t barSize, int16_t barWidth, int16_t maxDisplay, int16_t minDisplay,
+                                         int16_t arcAngle, bool clockWise, int16_t gradMarks) {
+
+  // Pointer types, colours and tags are drawn from the variables, the geometry does not need them.
+  if (gaugeStale) {
+    memcpy (gaugeParams.rangeTop, rangeTop, sizeof(rangeTop));
+    memcpy (gaugeParams.rangeBot, rangeBot, sizeof(rangeBot));
+    memcpy (gaugeParams.rangeColor, rangeColor, sizeof(rangeColor));
+    memcpy (gaugeParams.pointerValue, pointerValue, sizeof(pointerValue));
+    uint16_t grad[] = {gradMajorColor, gradMajorLength, gradMajorWidth, gradMinorColor, gradMinorLength, gradMinorWidth};
+    memcpy (gaugeParams.grad, grad, sizeof(grad));
+    memcpy (gaugeParams.rangeValid, rangeValid, sizeof(rangeValid));
+    gaugeKey = gaugeHash (2166136261u, &gaugeParams, offsetof(ArcGraphKey, args));
+    gaugeStale = false;
+  }
+
+  int16_t args[] = {barSize, barWidth, maxDisplay, minDisplay, arcAngle, clockWise, gradMarks};
+  memcpy (gaugeParams.args, args, sizeof(args));
+  uint32_t key = gaugeHash (gaugeKey, args, sizeof(args));
+  if (key == 0) key = 1;
+
+  // The hash only picks the slot, a hit needs the same parameters.
+  ArcGraphCache *slot = &arcCache[0];
+  for (int16_t i = 0; i < ARC_GRAPH_CACHE; i++) {
+    if (arcCache[i].key == key && memcmp (&arcCache[i].params, &gaugeParams, sizeof(gaugeParams)) == 0) {
+      arcCache[i].used = ++arcCacheUses;
+      return arcCache[i];
+    }
+    if (arcCache[i].used < slot->used) slot = &arcCache[i];
+  }
 
-  // Define floating point variables derived from integer parameters                   
+  ArcGraphCache &g = *slot;
+  g.key = key;
+  memcpy (&g.params, &gaugeParams, sizeof(gaugeParams));
+  g.used = ++arcCacheUses;
 
   float _normAxis;
-  float _pointerAdj[NUM_POINTERS + 1];
-  float _rangeTopAdj[NUM_RANGES + 1];
-  float _rangeBotAdj[NUM_RANGES + 1];
-  float _startAngle = startAngle * DEG_TO_RAD;
   float _arcAngle = abs(arcAngle) * DEG_TO_RAD; 
   
   if ((maxDisplay - minDisplay) != 0) _normAxis = _arcAngle / (maxDisplay - minDisplay);
@@ -832,176 +921,156 @@ void Gauges::arcGraph (int16_t x0, int16_t y0, int16_t barSize, int16_t barWidth
   
   float _maxDisplay = _normAxis * maxDisplay;
   float _minDisplay = _normAxis * minDisplay;  
-  
-  float _theta = _startAngle - _minDisplay; // for widget rotation
-  //float _cosA, cosB, _sinA, _sinB;
-  //int16_t _X1, _X2, _X3, _X4, _Y1, _Y2, _Y3, _Y4;
+  g.minDisplay = _minDisplay;
   
   // Scale all the pointers.
   
-  for (int i = 1; i <= NUM_POINTERS; i++){
-    _pointerAdj[i] = _normAxis * pointerValue[i];
+  for (int16_t i = 1; i <= NUM_POINTERS; i++){
+    float _pointerAdj = _normAxis * pointerValue[i];
+    if (_pointerAdj < _minDisplay) _pointerAdj = _minDisplay;
+    if (_pointerAdj > _maxDisplay) _pointerAdj = _maxDisplay;
+    if (!clockWise) _pointerAdj = PI - _pointerAdj;
+    g.pointerAdj[i] = _pointerAdj;
   }
 
   // Normalize all of the gauge ranges.
 
   for (int16_t i = 1; i <= NUM_RANGES; i++){
-    _rangeTopAdj[i] = rangeTop[i] * _normAxis; // SCALEUP;
-    _rangeBotAdj[i] = rangeBot[i] * _normAxis; // SCALEUP;
+    float _rangeTopAdj = rangeTop[i] * _normAxis; // SCALEUP;
+    float _rangeBotAdj = rangeBot[i] * _normAxis; // SCALEUP;
     
-    if (_rangeTopAdj[i] > _maxDisplay) _rangeTopAdj[i] = _maxDisplay;
-    if (_rangeBotAdj[i] < _minDisplay) _rangeBotAdj[i] = _minDisplay;
- 
-	// Draw all of the enabled display sectors.  Setting non-overlaping ranges allows for blank bars between ranges.
+    if (_rangeTopAdj > _maxDisplay) _rangeTopAdj = _maxDisplay;
+    if (_rangeBotAdj < _minDisplay) _rangeBotAdj = _minDisplay;
 
-	if (rangeValid[i]) {
-      drawArc (x0,  y0,  barSize-barWidth/2, (_theta + _rangeBotAdj[i]), abs(_rangeTopAdj[i] - _rangeBotAdj[i]), 
-      rangeColor[i],  barWidth,  gdraw.alphaBlend (96, TFT_BLACK, rangeColor[i]), 1);
-	}
+    g.rangeBot[i] = _rangeBotAdj;
+    g.rangeSweep[i] = fabs(_rangeTopAdj - _rangeBotAdj);
+    g.rangeEdge[i] = rangeValid[i] ? gdraw.alphaBlend (96, TFT_BLACK, rangeColor[i]) : 0;
   }
 
-  // Draw dial graduations
-  
-  if (gradMarks > 1) {
-  
-      float delta = _arcAngle / gradMarks;
-	  
-	for (float i = 0; i <= _arcAngle; i += delta) { // major marks
-      float _angle = i + _startAngle;
-	  float _cosA = cos (_angle);
-	  float _sinA = sin (_angle);
-	  float _cosB = -sin (_angle);
-	  //float _sinB = cos (_angle);
-	  
-	  if (!clockWise) {
-		_cosA = -_cosA;
-		_cosB = -_cosB;
-	  }
-	  
-	  float _X1 = x0 + (barSize - 1.25f * barWidth) * _cosA;
-	  float _Y1 = y0 + (barSize - 1.25f * barWidth) * _sinA;
-	  float _X2 = x0 + barSize * _cosA;
-	  float _Y2 = y0 + barSize * _sinA;
-      
-	  drawLine (_X1, _Y1, _X2, _Y2, TFT_WHITE, 4, NONE, gdraw.alphaBlend (96, TFT_BLACK, TFT_LIGHTGREY), 1);
-	}
+  // Dial graduations, counted with the same float steps they were always drawn with, 
+  // which decide whether the last mark falls inside the arc.
+
+  g.major.count = 0;
+  g.minor.count = 0;
+  g.tickDelta = 0;
+
+  if ((gradMarks > 1 || gradMarks < -1) && _arcAngle > 0) {
+    int16_t marks = abs(gradMarks);
+    float delta = _arcAngle / marks;
+    g.tickDelta = delta * (TRIG_TURN / TWO_PI);
+
+    for (float i = 0; i <= _arcAngle; i += delta) g.major.count++;
+    for (float i = _arcAngle / (marks * 2); i < _arcAngle; i += delta) g.minor.count++;
+    g.major.first = 0;
+    g.minor.first = _arcAngle / (marks * 2) * (TRIG_TURN / TWO_PI);
+
+    if (gradMarks > 1) {
+      uint16_t edge = gdraw.alphaBlend (96, TFT_BLACK, TFT_LIGHTGREY);
+      g.major.inner = barSize - 1.25f * barWidth;
+      g.major.color = TFT_WHITE;
+      g.major.width = 4;
+      g.major.edgeColor = edge;
+      g.minor.inner = barSize - 0.75f * barWidth;
+      g.minor.color = TFT_WHITE;
+      g.minor.width = 4;
+      g.minor.edgeColor = edge;
+    }
+    else {
+      if (gradMajorLength == 0) g.major.count = 0;
+      if (gradMinorLength == 0) g.minor.count = 0;
+      g.major.inner = barSize - gradMajorLength;
+      g.major.color = gradMajorColor;
+      g.major.width = gradMajorWidth;
+      g.major.edgeColor = TFT_DARKGREY;
+      g.minor.inner = barSize - gradMinorLength;
+      g.minor.color = gradMinorColor;
+      g.minor.width = gradMinorWidth;
+      g.minor.edgeColor = TFT_DARKGREY;
+    }
+  }
 
-	for (float i = _arcAngle / (gradMarks * 2); i < _arcAngle; i += delta) { // minor marks
-      float _angle = i + _startAngle;
-	  float _cosA = cos (_angle);
-	  float _sinA = sin (_angle);
-	  float _cosB = -sin (_angle);
-	  //float _sinB = cos (_angle);
-	  
-	  if (!clockWise) {
-		_cosA = -_cosA;
-		_cosB = -_cosB;
-	  }
+  return g;
+}
 
+// Graduation marks from the cached angles, rotated by start (TRIG_TURN units)
+static void drawArcTicks (Gauges &gauge, int16_t x0, int16_t y0, int16_t barSize, float start, float delta,
+                          const ArcGraphTicks &ticks, bool clockWise) {
+  float angle = start + ticks.first;
+  
+  for (uint16_t k = 0; k < ticks.count; k++, angle += delta) {
+    uint16_t a = (uint16_t)(int32_t)lroundf (angle);
+    float _cosA = trigCos (a) * (1.0f / TRIG_ONE);
+    float _sinA = trigSin (a) * (1.0f / TRIG_ONE);
+    if (!clockWise) _cosA = -_cosA;
 
-	  float _X1 = x0 + (barSize - 0.75f * barWidth) * _cosA;
-	  float _Y1 = y0 + (barSize - 0.75f * barWidth) * _sinA;
-	  float _X2 = x0 + barSize * _cosA;
-	  float _Y2 = y0 + barSize * _sinA;
-      
-      drawLine (_X1, _Y1, _X2, _Y2, TFT_WHITE, 4, NONE, gdraw.alphaBlend (96, TFT_BLACK, TFT_LIGHTGREY), 1);
-	}  
+    gauge.drawLine (x0 + ticks.inner * _cosA, y0 + ticks.inner * _sinA, x0 + barSize * _cosA, y0 + barSize * _sinA, 
+                    ticks.color, ticks.width, NONE, ticks.edgeColor, 1);
   }
+}
+
+/*
+   Arc bar graph gauge, both clockwise and counterclockwise.
+*/
+void Gauges::arcGraph (int16_t x0, int16_t y0, int16_t barSize, int16_t barWidth, int16_t maxDisplay, int16_t minDisplay,
+                       int16_t startAngle, int16_t arcAngle, bool clockWise, int16_t gradMarks) {
+
+  // Everything but the rotation comes from the cache, the rotation is added to each element.
+
+  ArcGraphCache &g = arcGraphGeometry (barSize, barWidth, maxDisplay, minDisplay, arcAngle, clockWise, gradMarks);
+
+  float _startAngle = startAngle * DEG_TO_RAD;
+  float _arcAngle = abs(arcAngle) * DEG_TO_RAD; 
+  float _theta = _startAngle - g.minDisplay; // for widget rotation
   
-  if (gradMarks < -1) {
-  
-    float delta = _arcAngle / -gradMarks;
-	
-    if (gradMajorLength != 0){
-    
-      for (float i = 0; i <= _arcAngle; i += delta) { // major marks
-        float _angle = i + _startAngle;
-        float _cosA = cos (_angle);
-        float _sinA = sin (_angle);
-        float _cosB = -sin (_angle);
-        //float _sinB = cos (_angle);
-        
-        if (!clockWise) {
-          _cosA = -_cosA;
-          _cosB = -_cosB;
-        }
-        
-        float _X1 = x0 + (barSize - gradMajorLength) * _cosA;
-        float _Y1 = y0 + (barSize - gradMajorLength) * _sinA;
-        float _X2 = x0 + barSize * _cosA;
-        float _Y2 = y0 + barSize * _sinA;
-        
-        drawLine (_X1, _Y1, _X2, _Y2, gradMajorColor, gradMajorWidth, NONE, TFT_DARKGREY, 1);	
-      }
-    }
-   
-    if (gradMinorLength != 0){
-    
-      for (float i = _arcAngle / (-gradMarks * 2); i < _arcAngle; i += delta) { // minor marks
-        float _angle = i + _startAngle;
-        float _cosA = cos (_angle);
-        float _sinA = sin (_angle);
-        float _cosB = -sin (_angle);
-        //float _sinB = cos (_angle);
-        
-        if (!clockWise) {
-          _cosA = -_cosA;
-          _cosB = -_cosB;
-        }
-        
-        int16_t _X1 = x0 + (barSize - gradMinorLength) * _cosA;
-        int16_t _Y1 = y0 + (barSize - gradMinorLength) * _sinA;
-        int16_t _X2 = x0 + barSize * _cosA;
-        int16_t _Y2 = y0 + barSize * _sinA;
-        
-        drawLine (_X1, _Y1, _X2, _Y2, gradMinorColor, gradMinorWidth, NONE, TFT_DARKGREY, 1);	
-      }
-    }
+  // Draw all of the enabled display sectors.  Setting non-overlaping ranges allows for blank bars between ranges.
+
+  for (int16_t i = 1; i <= NUM_RANGES; i++){
+	if (rangeValid[i]) {
+      drawArc (x0,  y0,  barSize-barWidth/2, (_theta + g.rangeBot[i]), g.rangeSweep[i], 
+      rangeColor[i],  barWidth,  g.rangeEdge[i], 1);
+	}
   }
 
+  // Draw dial graduations
+  
+  float start = _startAngle * (TRIG_TURN / TWO_PI);
+  drawArcTicks (*this, x0, y0, barSize, start, g.tickDelta, g.major, clockWise);
+  drawArcTicks (*this, x0, y0, barSize, start, g.tickDelta, g.minor, clockWise);
+
   // Text markers
 
   float midRadius = barSize-barWidth/2;
   
   if (clockWise){
-	  topDatumX = x0 +  midRadius * cos (_startAngle + _arcAngle);  
-	  topDatumY = y0 +  midRadius * sin (_startAngle + _arcAngle);  
+	  topDatumX = x0 +  midRadius * fastCos (_startAngle + _arcAngle);  
+	  topDatumY = y0 +  midRadius * fastSin (_startAngle + _arcAngle);  
                                                        
-	  btmDatumX = x0 +  midRadius * cos (_startAngle);  
-	  btmDatumY = y0 +  midRadius * sin (_startAngle);    
+	  btmDatumX = x0 +  midRadius * fastCos (_startAngle);  
+	  btmDatumY = y0 +  midRadius * fastSin (_startAngle);    
   }                                                  
   else {                                                 
-  	  btmDatumX = x0 +  midRadius * cos (_startAngle + _arcAngle);  
-	  btmDatumY = y0 +  midRadius * sin (_startAngle + _arcAngle);  
+  	  btmDatumX = x0 +  midRadius * fastCos (_startAngle + _arcAngle);  
+	  btmDatumY = y0 +  midRadius * fastSin (_startAngle + _arcAngle);  
                                            
-	  topDatumX = x0 +  midRadius * cos (_startAngle);    
-	  topDatumY = y0 +  midRadius * sin (_startAngle);  
+	  topDatumX = x0 +  midRadius * fastCos (_startAngle);    
+	  topDatumY = y0 +  midRadius * fastSin (_startAngle);  
   } 
   
-  // Pointer adjustments
+  // Pointers
 
-  float _Angle = _theta;
+  float _Angle = clockWise ? _theta : -_theta;
           
   for (int16_t i = 1; i <= NUM_POINTERS; i++){
-  
-      if (_pointerAdj[i] < _minDisplay) _pointerAdj[i]  = _minDisplay;
-      if (_pointerAdj[i] > _maxDisplay) _pointerAdj[i] = _maxDisplay;
-
-      if (!clockWise) {
-        _pointerAdj[i]  = PI - _pointerAdj[i];
-        _Angle = -_theta;  
-      }
-
     switch (pointerType[i]){
-      case ARROW_OUT: MarkArrowOut(x0, y0, barSize, barWidth, _pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
-      case ARROW_IN: MarkArrowIn(x0, y0, barSize, barWidth, _pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
-      case BAR_LONG: MarkRbar(x0, y0, barSize, barWidth, _pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
-      case BAR_SHORT: MarkRbarShort(x0, y0, barSize, barWidth, _pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
-      case BUG_OUT: MarkBugOut(x0, y0, barSize, barWidth, _pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
-      case BUG_IN: MarkBugIn(x0, y0, barSize, barWidth, _pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
-      case NEEDLE: MarkNeedle(x0, y0, barSize, barWidth, _pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
-      case INDEX: MarkIndex(x0, y0, barSize, barWidth, _pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
-      case ROUND_DOT: MarkRdot(x0, y0, barSize, barWidth, _pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
+      case ARROW_OUT: MarkArrowOut(x0, y0, barSize, barWidth, g.pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
+      case ARROW_IN: MarkArrowIn(x0, y0, barSize, barWidth, g.pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
+      case BAR_LONG: MarkRbar(x0, y0, barSize, barWidth, g.pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
+      case BAR_SHORT: MarkRbarShort(x0, y0, barSize, barWidth, g.pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
+      case BUG_OUT: MarkBugOut(x0, y0, barSize, barWidth, g.pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
+      case BUG_IN: MarkBugIn(x0, y0, barSize, barWidth, g.pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
+      case NEEDLE: MarkNeedle(x0, y0, barSize, barWidth, g.pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
+      case INDEX: MarkIndex(x0, y0, barSize, barWidth, g.pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
+      case ROUND_DOT: MarkRdot(x0, y0, barSize, barWidth, g.pointerAdj[i], pointerTag[i], _Angle, pointerColor[i]); break;
       default: break;
     }
    } 
@@ -1032,8 +1101,8 @@ int16_t Gauges::printNum (String value, int16_t x0, int16_t y0, int16_t width, i
   */
   float rollRad = (float)roll * DEG_TO_RAD;	
   
-  float cosRollRad = cos (rollRad);
-  float sinRollRad = sin (rollRad);
+  float cosRollRad = fastCos (rollRad);
+  float sinRollRad = fastSin (rollRad);
   
   float halfHeight = (float)height * 0.5f;
   float halfWidth = (float)width * 0.5f;
@@ -1754,8 +1823,8 @@ void Gauges::MarkArrowOut(float x0, float y0, float barSize, float barWidth, flo
         
   float _Pointer = (pointer + theta);
   //float _Factor = barSize / (barSize - 1.5f * barWidth);
-  float cosA = cos (_Pointer);
-  float sinA = sin (_Pointer);
+  float cosA = fastCos (_Pointer);
+  float sinA = fastSin (_Pointer);
   float bw1 = barSize + 0.50f * barWidth;
   float bw2 = barSize - 0.50f * barWidth;
   float bw3 = 0.33f * barWidth;
@@ -1775,13 +1844,13 @@ void Gauges::MarkArrowOut(float x0, float y0, float barSize, float barWidth, flo
   gdraw.setFreeFont (FSSB12);
   gdraw.setTextColor (TFT_BLACK);
   gdraw.setTextDatum (MC_DATUM);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize + barWidth) * cos(_Pointer)) - 1,
-                    y0 + (int16_t)((barSize + barWidth)*sin(_Pointer)) - 1, GFXFF);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize + barWidth) * cos(_Pointer)) + 1,
-                    y0 + (int16_t)((barSize + barWidth)*sin(_Pointer)) + 1, GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize + barWidth) * cosA) - 1,
+                    y0 + (int16_t)((barSize + barWidth)*sinA) - 1, GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize + barWidth) * cosA) + 1,
+                    y0 + (int16_t)((barSize + barWidth)*sinA) + 1, GFXFF);
   gdraw.setTextColor (color);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize + barWidth) * cos(_Pointer)),
-                    y0 + (int16_t)((barSize + barWidth)*sin(_Pointer)), GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize + barWidth) * cosA),
+                    y0 + (int16_t)((barSize + barWidth)*sinA), GFXFF);
  
 }
 
@@ -1800,8 +1869,8 @@ void Gauges::MarkArrowIn(float x0, float y0, float barSize, float barWidth, floa
         
   float _Pointer = (pointer + theta);
   //float _Factor = barSize / (barSize - 1.5f * barWidth);
-  float cosA = cos (_Pointer);
-  float sinA = sin (_Pointer);
+  float cosA = fastCos (_Pointer);
+  float sinA = fastSin (_Pointer);
   float bw1 = barSize - 1.50f * barWidth;
   float bw2 = barSize - 0.50f * barWidth;
   float bw3 = 0.33f * barWidth;
@@ -1821,13 +1890,13 @@ void Gauges::MarkArrowIn(float x0, float y0, float barSize, float barWidth, floa
   gdraw.setFreeFont (FSSB12);
   gdraw.setTextColor (TFT_BLACK);
   gdraw.setTextDatum (MC_DATUM);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 2.0f * barWidth) * cos (_Pointer)) - 1,
-                    y0 + (int16_t)((barSize - 2.0f * barWidth)*sin(_Pointer)) - 1, GFXFF);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 2.0f * barWidth) * cos (_Pointer)) + 1,
-                    y0 + (int16_t)((barSize - 2.0f * barWidth)*sin(_Pointer)) + 1, GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 2.0f * barWidth) * cosA) - 1,
+                    y0 + (int16_t)((barSize - 2.0f * barWidth)*sinA) - 1, GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 2.0f * barWidth) * cosA) + 1,
+                    y0 + (int16_t)((barSize - 2.0f * barWidth)*sinA) + 1, GFXFF);
   gdraw.setTextColor (color);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 2.0f * barWidth) * cos (_Pointer)),
-                    y0 + (int16_t)((barSize - 2.0f * barWidth)*sin(_Pointer)), GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 2.0f * barWidth) * cosA),
+                    y0 + (int16_t)((barSize - 2.0f * barWidth)*sinA), GFXFF);
 }
 
 void Gauges::MarkRbar(float x0, float y0, float barSize, float barWidth, float pointer, char tag, float theta, uint16_t color) {
@@ -1845,8 +1914,8 @@ void Gauges::MarkRbar(float x0, float y0, float barSize, float barWidth, float p
   */
   float _Pointer = (pointer + theta);
   
-  float cosA = cos(_Pointer);
-  float sinA = sin(_Pointer);
+  float cosA = fastCos(_Pointer);
+  float sinA = fastSin(_Pointer);
   
   float bw1 = barSize - 1.25f * barWidth;
   float bw2 = barSize + 0.25f * barWidth;
@@ -1862,13 +1931,13 @@ void Gauges::MarkRbar(float x0, float y0, float barSize, float barWidth, float p
   gdraw.setFreeFont (FSSB12);
   gdraw.setTextColor (TFT_WHITE);
   gdraw.setTextDatum (MC_DATUM);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 0.50f * barWidth) * cos(_Pointer)) - 1,
-                    y0 + (int16_t)((barSize - 0.50f * barWidth) * sin(_Pointer)) - 1 , GFXFF);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 0.50f * barWidth) * cos(_Pointer)) + 1,
-                    y0 + (int16_t)((barSize - 0.50f * barWidth)*sin(_Pointer)) + 1, GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 0.50f * barWidth) * cosA) - 1,
+                    y0 + (int16_t)((barSize - 0.50f * barWidth) * sinA) - 1 , GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 0.50f * barWidth) * cosA) + 1,
+                    y0 + (int16_t)((barSize - 0.50f * barWidth)*sinA) + 1, GFXFF);
   gdraw.setTextColor (TFT_BLACK);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 0.50f * barWidth)*cos(_Pointer)),
-                    y0 + (int16_t)((barSize - 0.50f * barWidth)*sin(_Pointer)), GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 0.50f * barWidth)*cosA),
+                    y0 + (int16_t)((barSize - 0.50f * barWidth)*sinA), GFXFF);
 }
 
 void Gauges::MarkRbarShort(float x0, float y0, float barSize, float barWidth, float pointer, char tag, float theta, uint16_t color) {
@@ -1886,8 +1955,8 @@ void Gauges::MarkRbarShort(float x0, float y0, float barSize, float barWidth, fl
   */
   float _Pointer = (pointer + theta);
   
-  float cosA = cos(_Pointer);
-  float sinA = sin(_Pointer);
+  float cosA = fastCos(_Pointer);
+  float sinA = fastSin(_Pointer);
     
   float bw1 = barSize - 0.125f * barWidth;
   float bw2 = barSize - 0.875f * barWidth;
@@ -1903,21 +1972,21 @@ void Gauges::MarkRbarShort(float x0, float y0, float barSize, float barWidth, fl
   gdraw.setFreeFont (FSSB12);
   gdraw.setTextColor (TFT_WHITE);
   gdraw.setTextDatum (MC_DATUM);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 0.50f * barWidth) * cos(_Pointer)) - 1,
-                    y0 + (int16_t)((barSize - 0.50f * barWidth) * sin(_Pointer)) - 1 , GFXFF);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 0.50f * barWidth) * cos(_Pointer)) + 1,
-                    y0 + (int16_t)((barSize - 0.50f * barWidth)*sin(_Pointer)) + 1, GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 0.50f * barWidth) * cosA) - 1,
+                    y0 + (int16_t)((barSize - 0.50f * barWidth) * sinA) - 1 , GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 0.50f * barWidth) * cosA) + 1,
+                    y0 + (int16_t)((barSize - 0.50f * barWidth)*sinA) + 1, GFXFF);
   gdraw.setTextColor (TFT_BLACK);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 0.50f * barWidth)*cos(_Pointer)),
-                    y0 + (int16_t)((barSize - 0.50f * barWidth)*sin(_Pointer)), GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 0.50f * barWidth)*cosA),
+                    y0 + (int16_t)((barSize - 0.50f * barWidth)*sinA), GFXFF);
 }
 
 void Gauges::MarkRdot(float x0, float y0, float barSize, float barWidth, float pointer, char tag, float theta, uint16_t color) {
 
   float _Pointer = (pointer + theta);
   
-  float x1 = x0 + (barSize - 0.50f * barWidth)* cos (_Pointer);
-  float y1 = y0 + (barSize - 0.50f * barWidth )* sin (_Pointer);
+  float x1 = x0 + (barSize - 0.50f * barWidth)* fastCos (_Pointer);
+  float y1 = y0 + (barSize - 0.50f * barWidth )* fastSin (_Pointer);
   
   gdraw.fillCircle (x1, y1, 0.25f * barWidth, color);
   gdraw.drawCircle (x1, y1, 0.25f * barWidth, TFT_BLACK);
@@ -1951,12 +2020,12 @@ void Gauges::MarkNeedle (float x0, float y0, float barSize, float barWidth, floa
   float _angleA = _Pointer - HALF_PI;
   float _angleB = _Pointer + HALF_PI;
   
-  float x1 = x0 + bw2 * cos(_angleA);
-  float y1 = y0 + bw2 * sin(_angleA);
-  float x2 = x0 + bw2 * cos(_angleB);
-  float y2 = y0 + bw2 * sin(_angleB);
-  float x3 = x0 + bw1 * cos(_Pointer);
-  float y3 = y0 + bw1 * sin(_Pointer);
+  float x1 = x0 + bw2 * fastCos(_angleA);
+  float y1 = y0 + bw2 * fastSin(_angleA);
+  float x2 = x0 + bw2 * fastCos(_angleB);
+  float y2 = y0 + bw2 * fastSin(_angleB);
+  float x3 = x0 + bw1 * fastCos(_Pointer);
+  float y3 = y0 + bw1 * fastSin(_Pointer);
 
   gdraw.fillTriangle (x1, y1, x2, y2, x3, y3, color);
   drawLine (x1, y1, x2, y2, TFT_BLACK, 1, NONE);
@@ -1983,10 +2052,13 @@ void Gauges::MarkIndex(float x0, float y0, float barSize, float barWidth, float
   
   float _Pointer = (pointer + theta);
 
-  float x1 = x0 + 0.5f * barSize * cos(_Pointer);
-  float y1 = y0 + 0.5f * barSize * sin(_Pointer);
-  float x2 = x0 + (barSize - 0.25 * barWidth) * cos(_Pointer);
-  float y2 = y0 + (barSize - 0.25 * barWidth) * sin(_Pointer);
+  float sinA, cosA;
+  fastSinCos (_Pointer, sinA, cosA);
+
+  float x1 = x0 + 0.5f * barSize * cosA;
+  float y1 = y0 + 0.5f * barSize * sinA;
+  float x2 = x0 + (barSize - 0.25 * barWidth) * cosA;
+  float y2 = y0 + (barSize - 0.25 * barWidth) * sinA;
 
   drawLine (x1, y1, x2, y2, color, 6, SHARP, TFT_BLACK, 1, SHARP);
   
@@ -2019,8 +2091,8 @@ void Gauges::MarkBugOut(float x0, float y0, float barSize, float barWidth, float
        
   */
 
-  float cosA = cos(_Pointer);
-  float sinA = sin(_Pointer);
+  float cosA = fastCos(_Pointer);
+  float sinA = fastSin(_Pointer);
 
   float bw2 = barSize - 0.5f * barWidth;
 										  
@@ -2063,13 +2135,13 @@ void Gauges::MarkBugOut(float x0, float y0, float barSize, float barWidth, float
   gdraw.setFreeFont (FSSB12);
   gdraw.setTextColor (TFT_BLACK);
   gdraw.setTextDatum (MC_DATUM);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize + barWidth) * cos(_Pointer)) - 1,
-                    y0 + (int16_t)((barSize + barWidth)*sin(_Pointer)) - 1, GFXFF);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize + barWidth) * cos(_Pointer)) + 1,
-                    y0 + (int16_t)((barSize + barWidth)*sin(_Pointer)) + 1, GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize + barWidth) * cosA) - 1,
+                    y0 + (int16_t)((barSize + barWidth)*sinA) - 1, GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize + barWidth) * cosA) + 1,
+                    y0 + (int16_t)((barSize + barWidth)*sinA) + 1, GFXFF);
   gdraw.setTextColor (color);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize + barWidth) * cos(_Pointer)),
-                    y0 + (int16_t)((barSize + barWidth)*sin(_Pointer)), GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize + barWidth) * cosA),
+                    y0 + (int16_t)((barSize + barWidth)*sinA), GFXFF);
 }
 
 void Gauges::MarkBugIn(float x0, float y0, float barSize, float barWidth, float pointer, char tag, float theta, uint16_t color) {
@@ -2087,8 +2159,8 @@ void Gauges::MarkBugIn(float x0, float y0, float barSize, float barWidth, float
     
   */
  
-  float cosA = cos(_Pointer);
-  float sinA = sin(_Pointer);
+  float cosA = fastCos(_Pointer);
+  float sinA = fastSin(_Pointer);
 								
   float bw1 = barSize - barWidth;
   float bw3 = 0.5f * barWidth;
@@ -2130,11 +2202,11 @@ void Gauges::MarkBugIn(float x0, float y0, float barSize, float barWidth, float
   gdraw.setFreeFont (FSSB12);
   gdraw.setTextColor (TFT_BLACK);
   gdraw.setTextDatum (MC_DATUM);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 2.0f * barWidth) * cos (_Pointer)) - 1,
-                    y0 + (int16_t)((barSize - 2.0f * barWidth)*sin(_Pointer)) - 1, GFXFF);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 2.0f * barWidth) * cos (_Pointer)) + 1,
-                    y0 + (int16_t)((barSize - 2.0f * barWidth)*sin(_Pointer)) + 1, GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 2.0f * barWidth) * cosA) - 1,
+                    y0 + (int16_t)((barSize - 2.0f * barWidth)*sinA) - 1, GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 2.0f * barWidth) * cosA) + 1,
+                    y0 + (int16_t)((barSize - 2.0f * barWidth)*sinA) + 1, GFXFF);
   gdraw.setTextColor (color);
-  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 2.0f * barWidth) * cos (_Pointer)),
-                    y0 + (int16_t)((barSize - 2.0f * barWidth)*sin(_Pointer)), GFXFF);
+  gdraw.drawString ((String)tag, x0 + (int16_t)((barSize - 2.0f * barWidth) * cosA),
+                    y0 + (int16_t)((barSize - 2.0f * barWidth)*sinA), GFXFF);
 }
\ No newline at end of file
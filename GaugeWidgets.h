@@ -43,6 +43,15 @@ OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
       
     Version 3.2, December 24, 2021:
       * Added INDEX pointer type to arc/circle gauges. VRL
+
+    Version 3.3:
+      * fillArc fills annulus sectors row by row (ArcRaster.h) instead of tessellating them into triangles.
+        Set arcScanline false for the triangles.
+      * Sines and cosines come from the table in FastTrig.h rather than libm.
+      * Added drawArc16 and fillArc16, with angles in FastTrig.h units (TRIG_TURN to the turn).
+      * arcGraph keeps the geometry of the last ARC_GRAPH_CACHE gauges it drew, so that a gauge drawn again
+        with only its start angle changed just rotates it.  Set gaugeStale after writing the pointer, range or
+        graduation mark variables directly rather than through the set methods.
       
 */
 
@@ -50,6 +59,7 @@ OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
   #define _GAUGEWIDGETS_H_
   #include <TFT_eSPI.h>
   #include "Free_Fonts.h"
+  #include "FastTrig.h"
     /*
      Helpful definitions for various gauge markers
      */
@@ -93,6 +103,48 @@ OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
     #define NUM_POINTERS 8
     #define NUM_RANGES 5
 
+    /*
+     Number of arc graph geometries kept, one per gauge drawn with different pointers or ranges.
+     */
+    #define ARC_GRAPH_CACHE 2
+
+    /*
+     Arc graph geometry apart from its rotation: angles from the start of the arc and colours.
+     */
+    struct ArcGraphTicks {
+      uint16_t count;                        // marks drawn
+      float    first;                        // angle of the first mark in TRIG_TURN units
+      float    inner;                        // radius the mark starts from
+      uint16_t color, width, edgeColor;
+    };
+
+    /*
+     Everything the arc graph geometry is worked out from, compared in full on a cache hit.  Laid out
+     without padding so that it compares with memcmp.
+     */
+    struct ArcGraphKey {
+      int32_t  rangeTop [NUM_RANGES + 1];
+      int32_t  rangeBot [NUM_RANGES + 1];
+      int32_t  rangeColor [NUM_RANGES + 1];
+      int32_t  pointerValue [NUM_POINTERS + 1];
+      uint16_t grad [6];                     // graduation mark colours, lengths and widths
+      bool     rangeValid [NUM_RANGES + 1];
+      int16_t  args [7];                     // arcGraph's, last as they change from call to call
+    };
+
+    struct ArcGraphCache {
+      uint32_t key;                          // hash of params, picks the slot, 0 for an empty slot
+      ArcGraphKey params;
+      uint32_t used;                         // when last drawn, the least recent is replaced
+      float    minDisplay;                   // scaled, for the rotation
+      float    pointerAdj [NUM_POINTERS + 1];// clamped and mirrored for counterclockwise gauges
+      float    rangeBot [NUM_RANGES + 1];
+      float    rangeSweep [NUM_RANGES + 1];
+      uint16_t rangeEdge [NUM_RANGES + 1];   // blended edge colours
+      float    tickDelta;                    // between marks in TRIG_TURN units
+      ArcGraphTicks major, minor;
+    };
+
     class Gauges {
 
       public:
@@ -179,6 +231,16 @@ OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
                       float startAngle, float arcAngle, 
                       uint16_t lineColor, uint16_t lineWidth = 1,    
                       uint16_t edgeColor = TFT_WHITE, uint16_t edgeWidth = 1, uint8_t edgeEnd = NONE);  
+
+        void drawArc16 (int16_t x0, int16_t y0, int16_t radius,                                // angles in TRIG_TURN units, arcAngle < 0 counterclockwise
+                        uint16_t startAngle, int32_t arcAngle, 
+                        uint16_t lineColor, uint16_t lineWidth = 1,    
+                        uint16_t edgeColor = NONE, uint16_t edgeWidth = 0, uint8_t edgeEnd = NONE);
+
+        void fillArc16 (int16_t x0, int16_t y0, int16_t radius,                                // angles in TRIG_TURN units, arcAngle < 0 counterclockwise
+                        uint16_t startAngle, int32_t arcAngle, 
+                        uint16_t lineColor, uint16_t lineWidth = 1,    
+                        uint16_t edgeColor = TFT_WHITE, uint16_t edgeWidth = 1, uint8_t edgeEnd = NONE);  
                 
         void gradMarkArc (int16_t x0, int16_t y0, int16_t radius, float starAngle, float arcAngle); 
                             
@@ -245,13 +307,25 @@ OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
         uint16_t gradMinorLength; 
         uint16_t gradMinorWidth;
         uint8_t  gradLineEnd;		// graduation marks have their own line end type
+        bool     gaugeStale;        // set after writing the pointer, range or graduation mark variables directly
         
         uint16_t fillColor, lineColor, edgeColor;
         uint16_t lineWidth, edgeWidth;     
         uint8_t  lineEnd, edgeEnd;
 
+        float    arcStep;           // arc tessellation in radians, ARCSTEP by default. Larger steps draw faster.
+        bool     arcScanline;       // fill arcs row by row (ArcRaster.h), true by default. False tessellates at arcStep.
+
       private:
 
+        ArcGraphCache arcCache [ARC_GRAPH_CACHE];
+        uint32_t arcCacheUses;
+        ArcGraphKey gaugeParams;    // of the arcGraph being drawn, the pointers, ranges and graduation marks while !gaugeStale
+        uint32_t gaugeKey;          // hash of those
+
+        ArcGraphCache &arcGraphGeometry (int16_t barSize, int16_t barWidth, int16_t maxDisplay, int16_t minDisplay,
+                                         int16_t arcAngle, bool clockWise, int16_t gradMarks);
+
         /*
          Pointer types for vertical or horizontal bar graph
          */
@@ -0,0 +1,229 @@
+/*
+  DisplayList.h - compact recorded frame, replayed into an 8 or 4 bit frame buffer.
+
+  FrameSprite records the draws of a frame into a byte arena instead of writing pixels, and
+  the list is filled into the frame buffer later, possibly on the other core while the next
+  frame is being recorded.  Each command is an opcode byte followed by its operands; all
+  coordinates are already clipped to the frame, x and widths take two bytes (low byte first),
+  y and heights one, colours are pixel values as stored in the frame buffer (RGB332, or a
+  palette index in a 4 bit buffer):
+
+      DL_PIXEL  color x y        5 bytes
+      DL_HLINE  color x y w      7 bytes
+      DL_VLINE  color x y h      6 bytes
+      DL_RECT   color x y w h    8 bytes
+      DL_CLEAR  color            2 bytes, the whole frame
+      DL_LAYER                   1 byte,  copy of the static layer
+
+  replayBand() fills the part of the list that falls on a range of lines, so the list can be
+  filled strip by strip into a buffer that only holds a few lines of the frame with the same
+  result as one pass.
+
+  A list can be dumped to the console as text and replayed on a desktop to profile single
+  commands (extras/host/DisplayListReplay.cpp):
+
+      DL <width> <height> <bpp> <bytes> [partial]
+      [PAL <16 RGB565 palette entries as hex>, 4 bit buffers only]
+      <up to 32 bytes per line as hex>
+      DL END
+
+  "partial" marks a list that is only the end of its frame, the start having been filled
+  early because the arena was full.
+*/
+
+#ifndef _DISPLAYLIST_H_
+#define _DISPLAYLIST_H_
+
+#include <stdint.h>
+#include <string.h>
+
+enum DisplayOp
+{
+    DL_PIXEL = 1,
+    DL_HLINE,
+    DL_VLINE,
+    DL_RECT,
+    DL_CLEAR,
+    DL_LAYER,
+};
+
+// bytes taken by a command, 0 for an unknown opcode
+inline uint8_t displayOpSize(uint8_t op)
+{
+    static const uint8_t sizes[] = { 0, 5, 7, 6, 8, 2, 1 };
+    return op < sizeof(sizes) ? sizes[op] : 0;
+}
+
+// rectangle filled by a DL_PIXEL, DL_HLINE, DL_VLINE or DL_RECT command
+inline void displayOpRect(const uint8_t *p, uint32_t &x, int32_t &y, uint32_t &w, int32_t &h)
+{
+    uint8_t op = p[0];
+    x          = p[2] | (p[3] << 8);
+    y          = p[4];
+    w          = op == DL_HLINE || op == DL_RECT ? p[5] | (p[6] << 8) : 1;
+    h          = op == DL_VLINE ? p[5] : op == DL_RECT ? p[7] : 1;
+}
+
+class DisplayList
+{
+public:
+    DisplayList() : data(NULL), bytes(0), capacity(0), partial(false) {}
+
+    void attach(uint8_t *storage, uint32_t size)
+    {
+        data     = storage;
+        capacity = size;
+        clear();
+    }
+
+    void clear()
+    {
+        bytes   = 0;
+        partial = false;
+    }
+
+    // false when the arena is full, fill it into the frame and add again
+    bool add(uint16_t x, uint8_t y, uint16_t w, uint8_t h, uint8_t color)
+    {
+        uint8_t op = w == 1 ? (h == 1 ? DL_PIXEL : DL_VLINE) : (h == 1 ? DL_HLINE : DL_RECT);
+        uint8_t *p = reserve(op);
+        if (p == NULL)
+            return false;
+
+        *p++ = color;
+        *p++ = x;
+        *p++ = x >> 8;
+        *p++ = y;
+        if (op == DL_HLINE || op == DL_RECT)
+        {
+            *p++ = w;
+            *p++ = w >> 8;
+        }
+        if (op == DL_VLINE || op == DL_RECT)
+            *p = h;
+        return true;
+    }
+
+    bool addClear(uint8_t color)
+    {
+        uint8_t *p = reserve(DL_CLEAR);
+        if (p == NULL)
+            return false;
+        *p = color;
+        return true;
+    }
+
+    bool addLayer()
+    {
+        return reserve(DL_LAYER) != NULL;
+    }
+
+    // a command copied from another list
+    bool addCommand(const uint8_t *command)
+    {
+        uint8_t *p = reserve(command[0]);
+        if (p == NULL)
+            return false;
+        memcpy(p, command + 1, displayOpSize(command[0]) - 1);
+        return true;
+    }
+
+    uint8_t *data;
+    uint32_t bytes;
+    uint32_t capacity;
+    bool     partial; // the start of the frame was filled before this list
+
+private:
+    uint8_t *reserve(uint8_t op)
+    {
+        uint8_t size = displayOpSize(op);
+        if (bytes + size > capacity)
+            return NULL;
+
+        uint8_t *p = data + bytes;
+        bytes     += size;
+        *p         = op;
+        return p + 1;
+    }
+};
+
+// Fill w pixels from x on lines y0 to y1 - 1 of a 4 bit buffer, two pixels a byte with the
+// even pixel in the high nibble, as TFT_eSprite packs them.
+
+inline void fillPacked4(uint8_t *frame, uint32_t stride, uint32_t x, uint32_t w, int32_t y0, int32_t y1, uint8_t index)
+{
+    uint8_t  pair = (index << 4) | index;
+    uint8_t *line = frame + y0 * stride + (x >> 1);
+
+    for (int32_t y = y0; y < y1; y++, line += stride)
+    {
+        uint8_t *p     = line;
+        uint32_t count = w;
+        if (x & 1)
+        {
+            *p = (*p & 0xF0) | index;
+            p++;
+            count--;
+        }
+        memset(p, pair, count >> 1);
+        if (count & 1)
+            p[count >> 1] = (p[count >> 1] & 0x0F) | (index << 4);
+    }
+}
+
+// Fill the commands of a list, in order, on lines top to bottom - 1 of an 8 or 4 bit buffer.
+// layer is the static layer for DL_LAYER, the same size as the frame.  frame holds the frame
+// from line first on, first is top when it is only a strip.  Stops at an unknown opcode.
+
+inline void replayBand(const uint8_t *list, uint32_t bytes, const uint8_t *layer, uint8_t *frame, uint32_t stride,
+                       uint8_t bpp, int32_t top, int32_t bottom, int32_t first = 0)
+{
+    const uint8_t *p   = list;
+    const uint8_t *end = list + bytes;
+
+    while (p < end)
+    {
+        uint8_t op   = p[0];
+        uint8_t size = displayOpSize(op);
+        if (size == 0)
+            return;
+
+        if (op == DL_CLEAR)
+            memset(frame + (top - first) * stride, bpp == 4 ? (p[1] << 4) | p[1] : p[1], (bottom - top) * stride);
+        else if (op == DL_LAYER)
+        {
+            if (layer != NULL)
+                memcpy(frame + (top - first) * stride, layer + top * stride, (bottom - top) * stride);
+        }
+        else
+        {
+            uint8_t  color = p[1];
+            uint32_t x, w;
+            int32_t  y0, h;
+            displayOpRect(p, x, y0, w, h);
+
+            int32_t y1 = y0 + h;
+            if (y0 < top)
+                y0 = top;
+            if (y1 > bottom)
+                y1 = bottom;
+
+            uint8_t *line = frame + (y0 - first) * stride + x;
+            if (bpp == 4)
+                fillPacked4(frame, stride, x, w, y0 - first, y1 - first, color);
+            else if (w == 1)
+            {
+                for (int32_t y = y0; y < y1; y++, line += stride)
+                    *line = color;
+            }
+            else
+            {
+                for (int32_t y = y0; y < y1; y++, line += stride)
+                    memset(line, color, w);
+            }
+        }
+        p += size;
+    }
+}
+
+#endif // _DISPLAYLIST_H_
@@ -0,0 +1,129 @@
+/*
+  EnergyRate.h - specific excess power (Ps) from the OnSpeed serial frames.
+
+  Ps is the rate of change of specific energy expressed as a climb rate:
+
+      Ps = TAS * dTAS/dt / g + VSI
+
+  i.e. the vertical speed the aircraft would have if it held its airspeed.  It is updated
+  once per serial frame, entirely in fixed point:
+    - TAS from IAS with a density ratio built from a pressure-ratio table (Palt) and OAT,
+      square root taken with an integer square root
+    - dTAS/dt as an exponential average of the per-frame IAS change, scaled to TAS, so no
+      sample window is kept or recomputed
+  Floats only appear at the interface, where the serial values are converted on entry.
+*/
+
+#ifndef _ENERGYRATE_H_
+#define _ENERGYRATE_H_
+
+#include <stdint.h>
+
+#define PS_SMOOTHING_SHIFT 4   // derivative average weight 1/16, about 1.6 s at 10 Hz
+#define PS_LIMIT 9990          // fpm, display range
+#define PS_FPM_PER_KT2_S 5440  // 60 * 1.68781^2 / 32.174 = 5.3124 fpm per (kt * kt/s), Q10
+
+class EnergyRate
+{
+public:
+    EnergyRate(uint8_t framesPerSecond) : psFpm(0), tasKts(0), _framesPerSecond(framesPerSecond)
+    {
+        reset();
+    }
+
+    void reset()
+    {
+        _lastIAS = 0;
+        _dIAS    = 0;
+        _primed  = false;
+    }
+
+    // ias kts, vsi fpm, palt ft, oat deg C
+    void update(float ias, float vsi, float palt, int oat)
+    {
+        int32_t iasQ8 = (int32_t)(ias * 256.0f);
+
+        if (!_primed)
+        {
+            _lastIAS = iasQ8;
+            _primed  = true;
+        }
+
+        // smoothed IAS change per frame, Q16 kts, rounded so the average does not drift
+        int32_t change = (iasQ8 - _lastIAS) << 8;
+        _dIAS         += (change - _dIAS + (1 << (PS_SMOOTHING_SHIFT - 1))) >> PS_SMOOTHING_SHIFT;
+        _lastIAS       = iasQ8;
+
+        uint32_t factor = tasFactor((int32_t)palt, oat);             // Q12
+        int32_t  tasQ4  = (int32_t)(((int64_t)iasQ8 * factor) >> 16);
+        int32_t  dTAS   = (int32_t)(((int64_t)_dIAS * _framesPerSecond * factor) >> 20); // Q8 kts/s
+
+        int64_t  ps     = ((int64_t)tasQ4 * dTAS * PS_FPM_PER_KT2_S) >> 22; // Q4 * Q8 * Q10
+        ps             += (int32_t)vsi;
+
+        if (ps > PS_LIMIT)
+            ps = PS_LIMIT;
+        else if (ps < -PS_LIMIT)
+            ps = -PS_LIMIT;
+
+        psFpm  = (int16_t)ps;
+        tasKts = (int16_t)(tasQ4 >> 4);
+    }
+
+    // TAS/IAS = sqrt(theta / delta), Q12
+    static uint32_t tasFactor(int32_t palt, int oat)
+    {
+        // ISA pressure ratio every 2000 ft from -2000 to 40000 ft, Q16
+        static const uint32_t deltaTable[] = { 70413, 65536, 60936, 56601, 52519, 48679, 45069, 41680,
+                                               38499, 35519, 32727, 30117, 27677, 25400, 23277, 21300,
+                                               19462, 17754, 16169, 14701, 13354, 12130 };
+        if (palt < -2000)
+            palt = -2000;
+        else if (palt > 39999)
+            palt = 39999;
+
+        uint32_t index = (uint32_t)(palt + 2000) / 2000;
+        uint32_t frac  = (uint32_t)(palt + 2000) % 2000;
+        uint32_t delta = deltaTable[index] - (deltaTable[index] - deltaTable[index + 1]) * frac / 2000;
+
+        int32_t kelvin = oat + 273;
+        if (kelvin < 200)
+            kelvin = 200;
+        uint32_t theta    = ((uint32_t)kelvin << 16) / 288;                  // Q16
+        uint32_t sigmaInv = (uint32_t)(((uint64_t)theta << 24) / delta);    // Q24
+        return isqrt(sigmaInv);                                              // Q12
+    }
+
+    static uint32_t isqrt(uint32_t value)
+    {
+        uint32_t root = 0;
+        uint32_t bit  = 1UL << 30;
+
+        while (bit > value)
+            bit >>= 2;
+
+        while (bit != 0)
+        {
+            if (value >= root + bit)
+            {
+                value -= root + bit;
+                root   = (root >> 1) + bit;
+            }
+            else
+                root >>= 1;
+            bit >>= 2;
+        }
+        return root;
+    }
+
+    int16_t psFpm;  // specific excess power, fpm
+    int16_t tasKts; // true airspeed estimate, kts
+
+private:
+    uint8_t _framesPerSecond;
+    int32_t _lastIAS; // Q8 kts
+    int32_t _dIAS;    // Q16 kts per frame
+    bool    _primed;
+};
+
+#endif // _ENERGYRATE_H_
@@ -0,0 +1,104 @@
+/*
+  FrameInterp.h - render-rate interpolation of the 10 Hz OnSpeed frames.
+
+  Keeps the last two timestamped frames and returns values part way between them, so the
+  indexer, slip ball and horizon move smoothly at the display frame rate instead of stepping
+  at the serial rate.  The rendered values trail the input by one frame period: a frame that
+  arrives at t1 is fully reached at t1 + (t1 - t0).  Past that point the last frame is held.
+*/
+
+#ifndef _FRAMEINTERP_H_
+#define _FRAMEINTERP_H_
+
+#include <stdint.h>
+
+#define FRAME_INTERP_MAX_GAP 500 // ms, frames further apart than this are not blended
+
+struct FrameSample
+{
+    float AOA;
+    float Slip;
+    float Pitch;
+    float Roll;
+    float FlightPath;
+};
+
+class FrameInterp
+{
+public:
+    FrameInterp() : _prevTime(0), _lastTime(0), _frames(0)
+    {
+        _prev = _last = FrameSample{ 0, 0, 0, 0, 0 };
+    }
+
+    void push(uint32_t timeMs, const FrameSample &frame)
+    {
+        _prev     = _last;
+        _prevTime = _lastTime;
+        _last     = frame;
+        _lastTime = timeMs;
+        if (_frames < 2)
+            _frames++;
+    }
+
+    void latest(FrameSample &out) const
+    {
+        out = _last;
+    }
+
+    // true while sample() is still moving towards the last frame
+    bool blending(uint32_t timeMs) const
+    {
+        uint32_t period = _lastTime - _prevTime;
+        return _frames >= 2 && period != 0 && period <= FRAME_INTERP_MAX_GAP && timeMs - _lastTime < period;
+    }
+
+    void sample(uint32_t timeMs, FrameSample &out) const
+    {
+        uint32_t period = _lastTime - _prevTime;
+
+        if (_frames < 2 || period == 0 || period > FRAME_INTERP_MAX_GAP)
+        {
+            out = _last;
+            return;
+        }
+
+        float t = (float)(int32_t)(timeMs - _lastTime) / period;
+        if (t <= 0.0f)
+            t = 0.0f;
+        else if (t >= 1.0f)
+        {
+            out = _last;
+            return;
+        }
+
+        out.AOA        = lerp(_prev.AOA, _last.AOA, t);
+        out.Slip       = lerp(_prev.Slip, _last.Slip, t);
+        out.Pitch      = lerp(_prev.Pitch, _last.Pitch, t);
+        out.FlightPath = lerp(_prev.FlightPath, _last.FlightPath, t);
+
+        // roll takes the short way round through +/-180
+        float deltaRoll = _last.Roll - _prev.Roll;
+        if (deltaRoll > 180.0f)
+            deltaRoll -= 360.0f;
+        else if (deltaRoll < -180.0f)
+            deltaRoll += 360.0f;
+        out.Roll = _prev.Roll + deltaRoll * t;
+        if (out.Roll > 180.0f)
+            out.Roll -= 360.0f;
+        else if (out.Roll < -180.0f)
+            out.Roll += 360.0f;
+    }
+
+private:
+    static float lerp(float a, float b, float t)
+    {
+        return a + (b - a) * t;
+    }
+
+    FrameSample _prev, _last;
+    uint32_t    _prevTime, _lastTime;
+    uint8_t     _frames;
+};
+
+#endif // _FRAMEINTERP_H_
@@ -0,0 +1,178 @@
+/*
+  FrameScheduler.h - decides when the display renders a frame.
+
+  A frame is rendered when a new serial frame has been decoded, or when something else on the
+  screen needs to move (flashing, interpolation, page change, data timeout).  Frames are spaced
+  at least by a period derived from the measured render cost, so the display never takes more
+  than FRAME_CPU_SHARE percent of the loop and serial input, tones and buttons keep up.
+
+  A frame that would show what the panel already shows is not rendered at all: the sketch
+  hashes the state the page shows at display resolution, and if unchanged() finds it the same
+  as the last frame rendered the frame is skipped.  The skip rate is counted with the
+  histograms.
+
+  It also keeps two histograms: the wait from a serial frame arriving to the render that shows
+  it starting, and the achieved frame rate of each one second window.
+*/
+
+#ifndef _FRAMESCHEDULER_H_
+#define _FRAMESCHEDULER_H_
+
+#include <stdint.h>
+
+#define FRAME_CPU_SHARE 75               // percent of the loop the display may use
+#define FRAME_COST_SHIFT 3               // render cost average weight 1/8
+#define FRAME_HISTOGRAM_BUCKETS 7
+#define FRAME_FPS_WINDOW 1000000         // us
+#define FRAME_REPORT_PERIOD 10000000     // us
+
+class FrameScheduler
+{
+public:
+    FrameScheduler(uint32_t minPeriodUs)
+        : periodUs(minPeriodUs), costUs(0), _minPeriodUs(minPeriodUs), _lastStart(0), _dataSince(0),
+          _dataPending(false), _requested(true), _shownState(0), _windowStart(0), _windowFrames(0), _reportStart(0)
+    {
+        clearHistograms();
+    }
+
+    // a new serial frame has been decoded, keep the time of the oldest one not yet rendered
+    void dataArrived(uint32_t nowUs)
+    {
+        if (!_dataPending)
+            _dataSince = nowUs;
+        _dataPending = true;
+    }
+
+    // something other than new data needs a frame
+    void request()
+    {
+        _requested = true;
+    }
+
+    bool due(uint32_t nowUs) const
+    {
+        return (_dataPending || _requested) && nowUs - _lastStart >= periodUs;
+    }
+
+    // call when a render starts
+    void begin(uint32_t nowUs)
+    {
+        if (_dataPending)
+            waitHistogram[bucket((nowUs - _dataSince) / 1000, waitLimitMs)]++;
+        _dataPending = false;
+        _requested   = false;
+        _lastStart   = nowUs;
+    }
+
+    // Call after begin() with the state the frame would show, 0 if unknown.  true if the last
+    // frame rendered showed the same: call skip() instead of rendering and end().
+    bool unchanged(uint32_t state)
+    {
+        if (state != 0 && state == _shownState)
+            return true;
+        _shownState = state;
+        return false;
+    }
+
+    void skip()
+    {
+        skipped++;
+    }
+
+    // the panel shows something else than the last frame rendered
+    void forget()
+    {
+        _shownState = 0;
+    }
+
+    // call when the frame has been pushed
+    void end(uint32_t nowUs)
+    {
+        rendered++;
+        int32_t cost = nowUs - _lastStart;
+        costUs      += (cost - (int32_t)costUs) >> FRAME_COST_SHIFT;
+
+        periodUs = costUs * 100 / FRAME_CPU_SHARE;
+        if (periodUs < _minPeriodUs)
+            periodUs = _minPeriodUs;
+
+        _windowFrames++;
+        uint32_t elapsed = nowUs - _windowStart;
+        if (elapsed >= FRAME_FPS_WINDOW)
+        {
+            fpsHistogram[bucket((uint64_t)_windowFrames * 1000000 / elapsed, fpsLimit)]++;
+            _windowStart  = nowUs;
+            _windowFrames = 0;
+        }
+    }
+
+    // true once per report period, the histograms are cleared on the next call
+    bool report(uint32_t nowUs)
+    {
+        if (_reportDue)
+        {
+            clearHistograms();
+            _reportDue = false;
+        }
+        if (nowUs - _reportStart < FRAME_REPORT_PERIOD)
+            return false;
+        _reportStart = nowUs;
+        _reportDue   = true;
+        return true;
+    }
+
+    // bucket upper limits, the last bucket has none
+    static uint32_t waitLimitMs(uint8_t bucket)
+    {
+        static const uint16_t limits[FRAME_HISTOGRAM_BUCKETS - 1] = { 2, 5, 10, 20, 50, 100 };
+        return limits[bucket];
+    }
+
+    static uint32_t fpsLimit(uint8_t bucket)
+    {
+        static const uint16_t limits[FRAME_HISTOGRAM_BUCKETS - 1] = { 5, 10, 15, 20, 30, 45 };
+        return limits[bucket];
+    }
+
+    uint32_t periodUs; // current shortest frame period
+    uint32_t costUs;   // average render + push time
+    uint32_t waitHistogram[FRAME_HISTOGRAM_BUCKETS]; // serial frame to render start, ms
+    uint32_t fpsHistogram[FRAME_HISTOGRAM_BUCKETS];  // one second windows by frame rate
+    uint32_t rendered; // frames rendered since the last report
+    uint32_t skipped;  // frames skipped as unchanged
+
+private:
+    static uint8_t bucket(uint32_t value, uint32_t (*limit)(uint8_t))
+    {
+        uint8_t i = 0;
+        while (i < FRAME_HISTOGRAM_BUCKETS - 1 && value >= limit(i))
+            i++;
+        return i;
+    }
+
+    void clearHistograms()
+    {
+        for (uint8_t i = 0; i < FRAME_HISTOGRAM_BUCKETS; i++)
+        {
+            waitHistogram[i] = 0;
+            fpsHistogram[i]  = 0;
+        }
+        rendered   = 0;
+        skipped    = 0;
+        _reportDue = false;
+    }
+
+    uint32_t _minPeriodUs;
+    uint32_t _lastStart;
+    uint32_t _dataSince;
+    bool     _dataPending;
+    bool     _requested;
+    uint32_t _shownState; // of the last frame rendered, 0 if unknown
+    uint32_t _windowStart;
+    uint32_t _windowFrames;
+    uint32_t _reportStart;
+    bool     _reportDue;
+};
+
+#endif // _FRAMESCHEDULER_H_
@@ -0,0 +1,1237 @@
+/*
+  FrameSprite.cpp - damage tracking and partial window push for the frame buffer sprite.
+*/
+
+#include "FrameSprite.h"
+#include "PixelConvert.h"
+#include <stdlib.h>
+#include <string.h>
+
+// tile columns first..last as a bit mask
+static uint32_t spanMask(int32_t first, int32_t last)
+{
+    return (((uint32_t)2 << last) - 1) & ~(((uint32_t)1 << first) - 1);
+}
+
+// -----------------------------------------------
+
+FrameSprite::FrameSprite(TFT_eSPI *tft) : TFT_eSprite(tft), _layer(NULL), _waitUs(0), _convertUs(0), _rects(0), _recording(0), _banded(false), _rasterUs(0),
+      _captureList(NULL), _captureStart(0), _offscreenFull(false), _stripLines(0), _stripTop(0), _palette(NULL), _framePalette(NULL),
+      _lastColor(0), _lastIndex(0), _slots(0), _slotsChanged(0), _exactColors(NULL), _exactCount(0)
+{
+    lastPush      = FramePushStats{ 0, 0, 0, 0, 0, 0, 0 };
+    paletteMisses = 0;
+    listOverflows = 0;
+#if defined(ARDUINO_ARCH_ESP32)
+    _lineBuffer[0]  = NULL;
+    _lineBuffer[1]  = NULL;
+    _nextBuffer     = 0;
+    _pushTaskHandle = NULL;
+    _pushDone       = NULL;
+    _pushPending    = false;
+    _sendList       = NULL;
+#endif
+    for (int r = 0; r < FRAME_TILE_ROWS; r++)
+    {
+        _damage[r]    = 0;
+        _shown[r]     = 0;
+        _layerMask[r] = 0;
+        for (int c = 0; c < FRAME_TILE_COLS; c++)
+            _panelHash[r][c] = 0;
+    }
+    memset(_slotTiles, 0, sizeof(_slotTiles));
+    memset(_layerSlots, 0, sizeof(_layerSlots));
+    invalidate();
+}
+
+// -----------------------------------------------
+
+void FrameSprite::drawPixel(int32_t x, int32_t y, uint32_t color)
+{
+    if (viaFill())
+    {
+        fill(x, y, 1, 1, color);
+        return;
+    }
+    waitPush();
+    damage(x, y, 1, 1);
+    TFT_eSprite::drawPixel(x, y, color);
+}
+
+void FrameSprite::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+{
+    if (viaFill())
+    {
+        fill(x, y, w, 1, color);
+        return;
+    }
+    waitPush();
+    damage(x, y, w, 1);
+    TFT_eSprite::drawFastHLine(x, y, w, color);
+}
+
+void FrameSprite::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
+{
+    if (viaFill())
+    {
+        fill(x, y, 1, h, color);
+        return;
+    }
+    waitPush();
+    damage(x, y, 1, h);
+    TFT_eSprite::drawFastVLine(x, y, h, color);
+}
+
+void FrameSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+    if (viaFill())
+    {
+        fill(x, y, w, h, color);
+        return;
+    }
+    waitPush();
+    damage(x, y, w, h);
+    TFT_eSprite::fillRect(x, y, w, h, color);
+}
+
+// -----------------------------------------------
+
+void FrameSprite::invalidate()
+{
+    for (int r = 0; r < FRAME_TILE_ROWS; r++)
+        _forced[r] = 0xFFFFFFFF;
+}
+
+// -----------------------------------------------
+
+bool FrameSprite::createLayer()
+{
+    if (!_created)
+        return false;
+    if (_layer == NULL)
+        _layer = (uint8_t *)malloc(bufferSize());
+    return _layer != NULL;
+}
+
+// -----------------------------------------------
+
+void FrameSprite::deleteLayer()
+{
+    fence(); // a recorded or handed over list may still copy from it
+    free(_layer);
+    _layer = NULL;
+}
+
+// -----------------------------------------------
+
+void FrameSprite::saveLayer()
+{
+    if (_layer == NULL || !_created || _stripLines != 0) // no whole frame to save in strip mode
+        return;
+
+    fence();
+    memcpy(_layer, _img8, bufferSize());
+
+    int32_t rows = (_iheight + FRAME_TILE_SIZE - 1) >> FRAME_TILE_SHIFT;
+    int32_t cols = (_iwidth + FRAME_TILE_SIZE - 1) >> FRAME_TILE_SHIFT;
+    for (int32_t r = 0; r < rows; r++)
+    {
+        _layerMask[r] = 0;
+        for (int32_t c = 0; c < cols; c++)
+        {
+            bool blank;
+            tileHash(r, c, blank);
+            if (!blank)
+                _layerMask[r] |= (uint32_t)1 << c;
+        }
+    }
+    memcpy(_layerSlots, _slotTiles, sizeof(_slotTiles));
+}
+
+// -----------------------------------------------
+
+// The copy bypasses the draw overrides, so the layer's non-black tiles are marked here; its
+// black tiles behave like a fillSprite(TFT_BLACK) clear.  The frame's slot tiles start as
+// the layer's.
+
+void FrameSprite::restoreLayer()
+{
+    if (_layer == NULL || !_created || _offscreen.data != NULL)
+        return;
+
+    if (recording())
+    {
+        if (!_lists[_recording].addLayer() && listFull())
+            _lists[_recording].addLayer();
+    }
+    else
+    {
+        fence();
+        memcpy(_img8, _layer, bufferSize());
+    }
+    for (int r = 0; r < FRAME_TILE_ROWS; r++)
+        _damage[r] |= _layerMask[r];
+    memcpy(_slotTiles, _layerSlots, sizeof(_slotTiles));
+}
+
+// -----------------------------------------------
+
+// Like fillSprite(TFT_BLACK), but recorded when drawing into the display list.  No slot is
+// drawn anywhere until the frame draws it again.
+
+void FrameSprite::clear()
+{
+    if (!_created)
+        return;
+
+    if (_offscreen.data != NULL)
+    {
+        if (!_offscreen.addClear(0))
+            _offscreenFull = true;
+        return;
+    }
+    memset(_slotTiles, 0, sizeof(_slotTiles));
+    if (recording())
+    {
+        if (!_lists[_recording].addClear(0) && listFull())
+            _lists[_recording].addClear(0);
+        return;
+    }
+    fence();
+    fillSprite(TFT_BLACK);
+}
+
+// -----------------------------------------------
+
+bool FrameSprite::beginBands(uint32_t listBytes)
+{
+    if (!_created || _bpp < 4 || _iheight > 255) // the display list keeps lines in a byte
+        return false;
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (_lists[i].data != NULL)
+            continue;
+        uint8_t *storage = (uint8_t *)malloc(listBytes);
+        if (storage == NULL)
+            return false;
+        _lists[i].attach(storage, listBytes);
+    }
+
+    _banded = true;
+    return true;
+}
+
+// -----------------------------------------------
+
+void FrameSprite::setBanded(bool banded)
+{
+    if (!banded)
+        fence();
+    _banded = banded && _lists[0].data != NULL && _lists[1].data != NULL;
+}
+
+// -----------------------------------------------
+
+// Call between frames: the frame buffer is freed, so draws not yet filled in are lost.
+
+bool FrameSprite::beginStrips(uint16_t lines)
+{
+    if (!_created || _lists[0].data == NULL || _lists[1].data == NULL)
+        return false;
+    if (_stripLines != 0)
+        return true;
+
+    lines = (lines + FRAME_TILE_SIZE - 1) & ~(FRAME_TILE_SIZE - 1); // whole tiles in each strip
+    if (lines >= _iheight)
+        return false;
+
+    fence();
+    free(_img8_1); // first, the strip may well fit where the frame was
+    uint8_t *strip = (uint8_t *)calloc(((uint32_t)_iwidth * lines * _bpp) >> 3, 1);
+    if (strip == NULL)
+        strip = (uint8_t *)calloc(bufferSize(), 1); // just freed, so at least this fits
+    else
+        _stripLines = lines;
+    setBuffer(strip);
+
+    _lists[0].clear();
+    _lists[1].clear();
+    _recording = 0;
+    _stripTop  = 0;
+    return _stripLines != 0;
+}
+
+// -----------------------------------------------
+
+// Draws recorded so far in this frame are filled into the new frame buffer and carry on there.
+
+bool FrameSprite::endStrips()
+{
+    if (_stripLines == 0)
+        return true;
+
+    uint8_t *frame = (uint8_t *)calloc(bufferSize(), 1);
+    if (frame == NULL)
+        return false;
+
+    bool drawn = false;
+    for (uint8_t i = 0; i <= _recording; i++)
+    {
+        replayBand(_lists[i].data, _lists[i].bytes, _layer, frame, ((uint32_t)_iwidth * _bpp) >> 3, _bpp, 0, _iheight);
+        drawn = drawn || _lists[i].bytes != 0;
+        _lists[i].clear();
+    }
+    _lists[0].partial = drawn;
+    _recording        = 0;
+
+    free(_img8_1);
+    setBuffer(frame);
+    _stripLines = 0;
+    _stripTop   = 0;
+    return true;
+}
+
+// -----------------------------------------------
+
+void FrameSprite::setBuffer(uint8_t *buffer)
+{
+    _img8   = buffer;
+    _img8_1 = buffer;
+    _img8_2 = buffer;
+    _img4   = buffer;
+    _img    = (uint16_t *)buffer;
+}
+
+// -----------------------------------------------
+
+void FrameSprite::fence()
+{
+    flushBands();
+    waitPush();
+}
+
+// -----------------------------------------------
+
+// Same clipping and colour reduction as the sprite's own 8 bit primitives, then into the list.
+// A 4 bit sprite is filled here as well when not recording, the base class would take the
+// colour as a palette index.
+
+void FrameSprite::fill(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+    if (!clip(x, y, w, h))
+        return;
+
+    uint8_t pixel;
+    if (_bpp == 4)
+        pixel = colorIndex(color);
+    else
+        pixel = ((color & 0xE000) >> 8) | ((color & 0x0700) >> 6) | ((color & 0x0018) >> 3);
+
+    if (_offscreen.data != NULL) // kept for later, nothing on screen changes
+    {
+        if (!_offscreen.add(x, y, w, h, pixel))
+            _offscreenFull = true;
+        return;
+    }
+
+    markTiles(x, y, w, h);
+    markSlot(pixel, x, y, w, h);
+
+    if (!recording()) // 4 bit, drawn now
+    {
+        waitPush();
+        fillPacked4(_img8, _iwidth >> 1, x, w, y, y + h, pixel);
+        return;
+    }
+
+    if (!_lists[_recording].add(x, y, w, h, pixel) && listFull())
+        _lists[_recording].add(x, y, w, h, pixel);
+}
+
+// -----------------------------------------------
+
+// The recording list is full: fill it into the frame buffer now, or in strip mode, where there
+// is no frame buffer to fill, carry on in the other list.  false if there is no room left.
+
+bool FrameSprite::listFull()
+{
+    if (_stripLines == 0)
+    {
+        flushBands();
+        return true;
+    }
+    if (_recording == 0)
+    {
+        _recording   = 1;
+        _captureList = NULL;
+        _lists[1].clear();
+        return true;
+    }
+    listOverflows++;
+    return false;
+}
+
+// -----------------------------------------------
+
+// Palette entry for an RGB565 colour, the nearest one that is not a slot if it is not in the
+// palette.  Drawing repeats the same colour many times over, so the last answer is kept.
+
+uint8_t FrameSprite::colorIndex(uint32_t color)
+{
+    if (_palette == NULL)
+        return color & 0x0F;
+    if (color == _lastColor)
+        return _lastIndex;
+
+    uint8_t  best         = 0;
+    uint32_t bestDistance = UINT32_MAX;
+    for (uint8_t i = 0; i < FRAME_PALETTE_COLORS; i++)
+    {
+        uint16_t entry = _palette[i];
+        if (entry == color)
+        {
+            best         = i;
+            bestDistance = 0;
+            break;
+        }
+        if (_slots & (1 << i))
+            continue;
+
+        int32_t  red   = (int32_t)((entry >> 11) - ((color >> 11) & 0x1F)) * 2; // 5 bit channels to 6 bit
+        int32_t  green = (int32_t)((entry >> 5) & 0x3F) - (int32_t)((color >> 5) & 0x3F);
+        int32_t  blue  = (int32_t)((entry & 0x1F) - (color & 0x1F)) * 2;
+
+        uint32_t distance = red * red + green * green + blue * blue;
+        if (distance < bestDistance)
+        {
+            best         = i;
+            bestDistance = distance;
+        }
+    }
+    if (bestDistance != 0)
+        paletteMisses++;
+
+    _lastColor = color;
+    _lastIndex = best;
+    return best;
+}
+
+// -----------------------------------------------
+
+// Fill the recording list into the frame buffer.  Anything recorded after this
+// belongs to a frame that is already partly filled.
+
+void FrameSprite::flushBands()
+{
+    DisplayList &list = _lists[_recording];
+    if (list.bytes == 0 || _stripLines != 0) // strips are filled by the push
+        return;
+
+    waitPush(); // a handed over list is filled first
+
+    uint32_t start = micros();
+    replayBand(list.data, list.bytes, _layer, _img8, ((uint32_t)_iwidth * _bpp) >> 3, _bpp, 0, _iheight);
+    list.clear();
+    list.partial = true;
+    _captureList = NULL;
+    _rasterUs   += micros() - start;
+}
+
+// -----------------------------------------------
+
+bool FrameSprite::beginCapture()
+{
+    if (!recording())
+        return false;
+    _captureList  = &_lists[_recording];
+    _captureStart = _captureList->bytes;
+    return true;
+}
+
+// -----------------------------------------------
+
+bool FrameSprite::endCapture(uint8_t *draws, uint32_t size, uint32_t &bytes)
+{
+    DisplayList *list = _captureList;
+    _captureList      = NULL;
+    if (list == NULL || list != &_lists[_recording])
+        return false;
+
+    bytes = list->bytes - _captureStart;
+    if (bytes > size)
+        return false;
+    memcpy(draws, list->data + _captureStart, bytes);
+    return true;
+}
+
+// -----------------------------------------------
+
+// The commands are already clipped and converted, only their tiles have to be marked again.
+// When not recording they are filled into the frame buffer straight away.
+
+void FrameSprite::replay(const uint8_t *draws, uint32_t bytes)
+{
+    if (!_created || _offscreen.data != NULL)
+        return;
+
+    bool record = recording();
+    if (!record)
+    {
+        fence();
+        replayBand(draws, bytes, _layer, _img8, ((uint32_t)_iwidth * _bpp) >> 3, _bpp, 0, _iheight);
+    }
+
+    for (const uint8_t *p = draws; p < draws + bytes; p += displayOpSize(p[0]))
+    {
+        if (displayOpSize(p[0]) == 0)
+            return;
+
+        if (p[0] == DL_LAYER)
+        {
+            for (int r = 0; r < FRAME_TILE_ROWS; r++)
+                _damage[r] |= _layerMask[r];
+            memcpy(_slotTiles, _layerSlots, sizeof(_slotTiles));
+        }
+        else if (p[0] == DL_CLEAR)
+            memset(_slotTiles, 0, sizeof(_slotTiles));
+        else
+        {
+            uint32_t x, w;
+            int32_t  y, h;
+            displayOpRect(p, x, y, w, h);
+            markTiles(x, y, w, h);
+            markSlot(p[1], x, y, w, h);
+        }
+
+        if (record && !_lists[_recording].addCommand(p) && listFull())
+            _lists[_recording].addCommand(p);
+    }
+}
+
+// -----------------------------------------------
+
+void FrameSprite::dumpList(Print &out)
+{
+    const DisplayList &list = _lists[_recording];
+
+    out.printf("DL %d %d %u %u%s\n", _iwidth, _iheight, _bpp, list.bytes, list.partial ? " partial" : "");
+    if (_bpp == 4)
+    {
+        out.print("PAL");
+        for (int i = 0; i < FRAME_PALETTE_COLORS; i++)
+            out.printf(" %04X", getPaletteColor(i));
+        out.println();
+    }
+    for (uint32_t i = 0; i < list.bytes; i++)
+    {
+        out.printf("%02X", list.data[i]);
+        if ((i & 31) == 31 || i + 1 == list.bytes)
+            out.println();
+    }
+    out.println("DL END");
+}
+
+// -----------------------------------------------
+
+bool FrameSprite::setPalette(const uint16_t *palette)
+{
+    if (!_created || _bpp != 4)
+        return false;
+    if (palette == _palette)
+        return true;
+
+    fence(); // the push task expands pixels through the old palette
+    createPalette(palette, FRAME_PALETTE_COLORS);
+    _palette      = palette;
+    _lastColor    = palette[0];
+    _lastIndex    = 0;
+    _slots        = slotMask(palette);
+    _slotsChanged = 0;
+    for (int i = 0; i < FRAME_PALETTE_COLORS; i++)
+        _slotColor[i] = palette[i];
+    memset(_slotTiles, 0, sizeof(_slotTiles));
+    memset(_layerSlots, 0, sizeof(_layerSlots));
+    buildColorTable();
+    invalidate();
+    return true;
+}
+
+// -----------------------------------------------
+
+uint16_t FrameSprite::slotMask(const uint16_t *palette)
+{
+    uint16_t slots = 0;
+    for (int i = 0; i < FRAME_PALETTE_COLORS; i++)
+        if ((palette[i] & 0xFFF0) == FRAME_SLOT_COLOR(0))
+            slots |= 1 << i;
+    return slots;
+}
+
+// -----------------------------------------------
+
+// Draws go into the given buffer as display list commands, in the colours of the given
+// palette, with neither the frame, the recording list nor the tile state touched, so another
+// page can be drawn between two frames of this one.  Play them back with replay().
+
+bool FrameSprite::beginOffscreen(uint8_t *draws, uint32_t size, const uint16_t *palette)
+{
+    if (!_created || _offscreen.data != NULL)
+        return false;
+
+    _offscreen.attach(draws, size);
+    _offscreenFull = false;
+    _framePalette  = _palette;
+    if (_bpp == 4 && palette != NULL && palette != _palette)
+    {
+        _palette   = palette;
+        _slots     = slotMask(palette);
+        _lastColor = palette[0];
+        _lastIndex = 0;
+    }
+    return true;
+}
+
+// -----------------------------------------------
+
+bool FrameSprite::endOffscreen(uint32_t &bytes)
+{
+    if (_offscreen.data == NULL)
+        return false;
+
+    bytes      = _offscreen.bytes;
+    _offscreen = DisplayList();
+    if (_palette != _framePalette)
+    {
+        _palette   = _framePalette;
+        _slots     = slotMask(_palette);
+        _lastColor = _palette[0];
+        _lastIndex = 0;
+    }
+    return !_offscreenFull;
+}
+
+// -----------------------------------------------
+
+// The colour is only staged here, the panel may still be receiving the last frame.
+
+bool FrameSprite::setSlotColor(uint8_t index, uint16_t color)
+{
+    if (index >= FRAME_PALETTE_COLORS || !(_slots & (1 << index)))
+        return false;
+
+    if (color != _slotColor[index])
+    {
+        _slotColor[index] = color;
+        _slotsChanged    |= 1 << index;
+    }
+    return true;
+}
+
+// -----------------------------------------------
+
+// Through the palette in a 4 bit sprite, RGB332 or its colour table entry in an 8 bit one.
+
+uint16_t FrameSprite::shownColor(uint16_t color)
+{
+    if (_bpp == 4)
+        return getPaletteColor(colorIndex(color));
+    if (_bpp != 8)
+        return color;
+
+    uint8_t pixel = _tft->color16to8(color);
+#if defined(ARDUINO_ARCH_ESP32)
+    if (_pushTaskHandle != NULL) // the DMA push converts through the colour table
+        return (_colorTable[pixel] >> 8) | (_colorTable[pixel] << 8);
+#endif
+    return _tft->color8to16(pixel);
+}
+
+// -----------------------------------------------
+
+// 8 bit: each colour is shown exactly wherever it is drawn, instead of through RGB332, by
+// giving its RGB332 value its own colour table entry.  Other colours with the same RGB332 value
+// show it as well.  Only the DMA push uses the colour table.
+
+bool FrameSprite::setExactColors(const uint16_t *colors, uint8_t count)
+{
+    if (!_created || _bpp != 8)
+        return false;
+
+    fence(); // the push task converts through the table
+    _exactColors = colors;
+    _exactCount  = count;
+    buildColorTable();
+    invalidate();
+    return true;
+}
+
+// -----------------------------------------------
+
+// Put the staged slot colours into the palette once the last push is done, and resend the
+// tiles drawn in them.
+
+void FrameSprite::applySlots()
+{
+    for (uint8_t i = 0; _slotsChanged; i++)
+    {
+        if (!(_slotsChanged & (1 << i)))
+            continue;
+        _slotsChanged &= ~(1 << i);
+
+        setPaletteColor(i, _slotColor[i]);
+        for (int r = 0; r < FRAME_TILE_ROWS; r++)
+            _forced[r] |= _slotTiles[i][r];
+    }
+    buildColorTable();
+}
+
+// -----------------------------------------------
+
+// Apply the viewport datum and clip to the sprite, false if nothing is left.
+
+bool FrameSprite::clip(int32_t &x, int32_t &y, int32_t &w, int32_t &h)
+{
+    x += _xDatum;
+    y += _yDatum;
+
+    if (x < 0)
+    {
+        w += x;
+        x  = 0;
+    }
+    if (y < 0)
+    {
+        h += y;
+        y  = 0;
+    }
+    if (x + w > _iwidth)
+        w = _iwidth - x;
+    if (y + h > _iheight)
+        h = _iheight - y;
+    return w > 0 && h > 0;
+}
+
+// -----------------------------------------------
+
+void FrameSprite::damage(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    if (clip(x, y, w, h))
+        markTiles(x, y, w, h);
+}
+
+// -----------------------------------------------
+
+// Mark the tiles under a rectangle that is already clipped to the sprite.
+
+void FrameSprite::markTiles(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    uint32_t mask = spanMask(x >> FRAME_TILE_SHIFT, (x + w - 1) >> FRAME_TILE_SHIFT);
+    int32_t  last = (y + h - 1) >> FRAME_TILE_SHIFT;
+    for (int32_t r = y >> FRAME_TILE_SHIFT; r <= last; r++)
+        _damage[r] |= mask;
+}
+
+// -----------------------------------------------
+
+// 4 bit: remember the tiles drawn in a palette slot, they are resent when its colour changes.
+
+void FrameSprite::markSlot(uint8_t pixel, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    if (_bpp != 4 || !(_slots & (1 << pixel)))
+        return;
+
+    uint32_t mask = spanMask(x >> FRAME_TILE_SHIFT, (x + w - 1) >> FRAME_TILE_SHIFT);
+    for (int32_t r = y >> FRAME_TILE_SHIFT; r <= (y + h - 1) >> FRAME_TILE_SHIFT; r++)
+        _slotTiles[pixel][r] |= mask;
+}
+
+// -----------------------------------------------
+
+// FNV-1a over the tile's bytes in the sprite buffer, a word at a time where the lines allow it.
+// blank is set when the tile is all zero (black).
+
+uint32_t FrameSprite::tileHash(int16_t row, int16_t col, bool &blank)
+{
+    int32_t x0 = col << FRAME_TILE_SHIFT;
+    int32_t y0 = row << FRAME_TILE_SHIFT;
+    int32_t x1 = x0 + FRAME_TILE_SIZE;
+    int32_t y1 = y0 + FRAME_TILE_SIZE;
+    if (x1 > _iwidth)
+        x1 = _iwidth;
+    if (y1 > _iheight)
+        y1 = _iheight;
+
+    uint32_t stride = ((uint32_t)_iwidth * _bpp) >> 3;
+    uint32_t first  = ((uint32_t)x0 * _bpp) >> 3;
+    uint32_t bytes  = (((uint32_t)x1 * _bpp + 7) >> 3) - first;
+    uint32_t hash   = 2166136261UL;
+    uint32_t bits   = 0;
+
+    for (int32_t y = y0; y < y1; y++)
+    {
+        const uint8_t *line = _img8 + (y - _stripTop) * stride + first;
+
+        if ((((uintptr_t)line | bytes) & 3) == 0)
+        {
+            const uint32_t *word = (const uint32_t *)line;
+            for (uint32_t i = 0; i < bytes >> 2; i++)
+            {
+                hash  = (hash ^ word[i]) * 16777619UL;
+                bits |= word[i];
+            }
+        }
+        else
+        {
+            for (uint32_t i = 0; i < bytes; i++)
+            {
+                hash  = (hash ^ line[i]) * 16777619UL;
+                bits |= line[i];
+            }
+        }
+    }
+
+    blank = bits == 0;
+    return hash;
+}
+
+// -----------------------------------------------
+
+// Send the tiles whose content differs from the panel, directly or through the push task.
+
+void FrameSprite::pushFrame()
+{
+    if (!_created)
+        return;
+    if (_stripLines != 0)
+    {
+        pushStrips();
+        return;
+    }
+
+    uint32_t start = micros();
+    int32_t  rows  = (_iheight + FRAME_TILE_SIZE - 1) >> FRAME_TILE_SHIFT;
+
+#if defined(ARDUINO_ARCH_ESP32)
+    if (_banded && _pushTaskHandle != NULL)
+    {
+        waitPush(); // the list handed over last frame is filled and sent
+        if (_slotsChanged)
+            applySlots();
+
+        for (int32_t r = 0; r < FRAME_TILE_ROWS; r++)
+        {
+            _sendDamage[r] = _damage[r];
+            _sendForced[r] = _forced[r];
+            _damage[r]     = 0;
+            _forced[r]     = 0;
+        }
+        _sendList   = &_lists[_recording];
+        _recording ^= 1;
+        _lists[_recording].clear();
+
+        lastPush.waitUs   = _waitUs;
+        lastPush.rasterUs = _rasterUs; // the push task adds its own fill time
+        _waitUs           = 0;
+        _rasterUs         = 0;
+
+        _pushPending = true;
+        xTaskNotifyGive(_pushTaskHandle);
+        lastPush.pushUs = micros() - start;
+        return;
+    }
+#endif
+
+    fence();
+    _lists[_recording].clear();
+    if (_slotsChanged)
+        applySlots();
+
+    uint32_t dirty[FRAME_TILE_ROWS];
+    uint32_t pixels = collectDirty(_damage, _forced, dirty, 0, rows);
+    for (int32_t r = 0; r < FRAME_TILE_ROWS; r++)
+    {
+        _damage[r] = 0;
+        _forced[r] = 0;
+    }
+
+    lastPush.pixels   = pixels;
+    lastPush.waitUs   = _waitUs;
+    lastPush.rasterUs = _rasterUs;
+    _waitUs           = 0;
+    _rasterUs         = 0;
+
+#if defined(ARDUINO_ARCH_ESP32)
+    if (_pushTaskHandle != NULL)
+    {
+        for (int32_t r = 0; r < FRAME_TILE_ROWS; r++)
+            _sendDirty[r] = r < rows ? dirty[r] : 0;
+        _pushPending = true;
+        xTaskNotifyGive(_pushTaskHandle);
+        lastPush.pushUs = micros() - start;
+        return;
+    }
+#endif
+
+    sendDirty(dirty);
+    lastPush.rects  = _rects;
+    lastPush.pushUs = micros() - start;
+}
+
+// -----------------------------------------------
+
+// Check the tiles drawn or forced, plus the tiles the panel shows as not black, against the
+// panel checksums, on tile rows firstRow to endRow - 1.  Sets the changed tiles of those rows in
+// dirty and returns their pixel count.
+
+uint32_t FrameSprite::collectDirty(const uint32_t *damage, const uint32_t *forced, uint32_t *dirty, int32_t firstRow, int32_t endRow)
+{
+    int32_t  rows    = (_iheight + FRAME_TILE_SIZE - 1) >> FRAME_TILE_SHIFT;
+    int32_t  cols    = (_iwidth + FRAME_TILE_SIZE - 1) >> FRAME_TILE_SHIFT;
+    uint32_t colMask = spanMask(0, cols - 1);
+    uint32_t pixels  = 0;
+
+    if (endRow > rows)
+        endRow = rows;
+    for (int32_t r = firstRow; r < endRow; r++)
+    {
+        uint32_t candidates = (damage[r] | _shown[r] | forced[r]) & colMask;
+        int32_t  tileH      = _iheight - (r << FRAME_TILE_SHIFT);
+        if (tileH > FRAME_TILE_SIZE)
+            tileH = FRAME_TILE_SIZE;
+        dirty[r] = 0;
+
+        while (candidates)
+        {
+            int32_t  c   = __builtin_ctz(candidates);
+            uint32_t bit = (uint32_t)1 << c;
+            bool     blank;
+            uint32_t hash = tileHash(r, c, blank);
+
+            candidates &= candidates - 1;
+            if (hash != _panelHash[r][c] || (forced[r] & bit))
+            {
+                int32_t tileW = _iwidth - (c << FRAME_TILE_SHIFT);
+                if (tileW > FRAME_TILE_SIZE)
+                    tileW = FRAME_TILE_SIZE;
+
+                dirty[r]        |= bit;
+                _panelHash[r][c] = hash;
+                pixels          += tileW * tileH;
+            }
+            if (blank)
+                _shown[r] &= ~bit;
+            else
+                _shown[r] |= bit;
+        }
+    }
+    return pixels;
+}
+
+// -----------------------------------------------
+
+// Runs of dirty tiles along a tile row become one window, and a window grows downwards while
+// the rows below have the same run.
+
+void FrameSprite::sendDirty(uint32_t *dirty)
+{
+    int32_t rows = (_iheight + FRAME_TILE_SIZE - 1) >> FRAME_TILE_SHIFT;
+    int32_t cols = (_iwidth + FRAME_TILE_SIZE - 1) >> FRAME_TILE_SHIFT;
+
+    _rects = 0;
+    for (int32_t r = 0; r < rows; r++)
+    {
+        while (dirty[r])
+        {
+            int32_t c0 = __builtin_ctz(dirty[r]);
+            int32_t c1 = c0;
+            while (c1 + 1 < cols && (dirty[r] & ((uint32_t)1 << (c1 + 1))))
+                c1++;
+
+            uint32_t mask = spanMask(c0, c1);
+            int32_t  r1   = r;
+            dirty[r]     &= ~mask;
+            while (r1 + 1 < rows && (dirty[r1 + 1] & mask) == mask)
+            {
+                r1++;
+                dirty[r1] &= ~mask;
+            }
+
+            int32_t x = c0 << FRAME_TILE_SHIFT;
+            int32_t y = r << FRAME_TILE_SHIFT;
+            int32_t w = ((c1 + 1) << FRAME_TILE_SHIFT) - x;
+            int32_t h = ((r1 + 1) << FRAME_TILE_SHIFT) - y;
+            if (x + w > _iwidth)
+                w = _iwidth - x;
+            if (y + h > _iheight)
+                h = _iheight - y;
+
+            sendRect(x, y, w, h);
+            _rects++;
+        }
+    }
+}
+
+// -----------------------------------------------
+
+// Fill the recorded lists into the strip buffer one strip at a time and send each strip's
+// changed tiles before the next one overwrites it.  The windows go out on the DMA line buffers
+// when there are some, but from here: the strip buffer is reused as soon as they are queued.
+
+void FrameSprite::pushStrips()
+{
+    uint32_t start  = micros();
+    uint32_t stride = ((uint32_t)_iwidth * _bpp) >> 3;
+
+    waitPush();
+    if (_slotsChanged)
+        applySlots();
+
+#if defined(ARDUINO_ARCH_ESP32)
+    bool swap = _tft->getSwapBytes();
+    if (_pushTaskHandle != NULL)
+    {
+        _tft->setSwapBytes(false); // the colour table is already in SPI byte order
+        _tft->startWrite();
+    }
+#endif
+
+    uint32_t rasterUs = 0;
+    uint32_t pixels   = 0;
+    uint16_t rects    = 0;
+    for (int32_t top = 0; top < _iheight; top += _stripLines)
+    {
+        int32_t bottom = top + _stripLines;
+        if (bottom > _iheight)
+            bottom = _iheight;
+        _stripTop = top;
+
+        uint32_t fillStart = micros();
+        for (uint8_t i = 0; i <= _recording; i++)
+            replayBand(_lists[i].data, _lists[i].bytes, _layer, _img8, stride, _bpp, top, bottom, top);
+        rasterUs += micros() - fillStart;
+
+        uint32_t dirty[FRAME_TILE_ROWS] = { 0 };
+        pixels += collectDirty(_damage, _forced, dirty, top >> FRAME_TILE_SHIFT,
+                               (bottom + FRAME_TILE_SIZE - 1) >> FRAME_TILE_SHIFT);
+        sendDirty(dirty);
+        rects += _rects;
+    }
+
+#if defined(ARDUINO_ARCH_ESP32)
+    if (_pushTaskHandle != NULL)
+    {
+        _tft->dmaWait();
+        _tft->endWrite();
+        _tft->setSwapBytes(swap);
+    }
+#endif
+
+    for (int32_t r = 0; r < FRAME_TILE_ROWS; r++)
+    {
+        _damage[r] = 0;
+        _forced[r] = 0;
+    }
+    _lists[0].clear();
+    _lists[1].clear();
+    _recording = 0;
+
+    lastPush.pixels    = pixels;
+    lastPush.rects     = rects;
+    lastPush.waitUs    = _waitUs;
+    lastPush.rasterUs  = rasterUs;
+    lastPush.pushUs    = micros() - start;
+    lastPush.sendUs    = lastPush.pushUs - rasterUs;
+    lastPush.convertUs = _convertUs;
+    _waitUs            = 0;
+    _rasterUs          = 0;
+    _convertUs         = 0;
+}
+
+// -----------------------------------------------
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+#include <esp_heap_caps.h>
+
+bool FrameSprite::beginDMA()
+{
+    if (!_created || _bpp < 4 || (_iwidth & 1) || _pushTaskHandle != NULL)
+        return _pushTaskHandle != NULL;
+
+    uint32_t lineBytes = (uint32_t)_iwidth * FRAME_DMA_LINES * sizeof(uint16_t);
+    _lineBuffer[0]     = (uint16_t *)heap_caps_malloc(lineBytes, MALLOC_CAP_DMA);
+    _lineBuffer[1]     = (uint16_t *)heap_caps_malloc(lineBytes, MALLOC_CAP_DMA);
+    _pushDone          = xSemaphoreCreateBinary();
+
+    if (_lineBuffer[0] == NULL || _lineBuffer[1] == NULL || _pushDone == NULL || !_tft->initDMA())
+    {
+        heap_caps_free(_lineBuffer[0]);
+        heap_caps_free(_lineBuffer[1]);
+        _lineBuffer[0] = NULL;
+        _lineBuffer[1] = NULL;
+        return false;
+    }
+
+    buildColorTable();
+
+    // below the tone task, which is also on core 0
+    if (xTaskCreatePinnedToCore(pushTask, "pushTask", 2048, this, configMAX_PRIORITIES - 3, &_pushTaskHandle, 0) != pdPASS)
+    {
+        _pushTaskHandle = NULL;
+        return false;
+    }
+    return true;
+}
+
+// -----------------------------------------------
+
+// Same expansion as the blocking push, bytes swapped into SPI order, except for the exact
+// colours given to an 8 bit sprite.
+
+void FrameSprite::buildColorTable()
+{
+    if (_bpp == 4)
+    {
+        for (int i = 0; i < FRAME_PALETTE_COLORS; i++)
+        {
+            uint16_t color = getPaletteColor(i);
+            _colorTable[i] = (color >> 8) | (color << 8);
+        }
+        buildPairTable(_colorTable, _pairTable);
+        return;
+    }
+
+    for (int i = 0; i < 256; i++)
+    {
+        uint16_t color = _tft->color8to16(i);
+        _colorTable[i] = (color >> 8) | (color << 8);
+    }
+    for (uint8_t i = 0; i < _exactCount; i++)
+    {
+        uint16_t color = _exactColors[i];
+        uint8_t  pixel = ((color & 0xE000) >> 8) | ((color & 0x0700) >> 6) | ((color & 0x0018) >> 3);
+        _colorTable[pixel] = (color >> 8) | (color << 8);
+    }
+}
+
+// -----------------------------------------------
+
+void FrameSprite::waitPush()
+{
+    if (!_pushPending)
+        return;
+
+    uint32_t start = micros();
+    xSemaphoreTake(_pushDone, portMAX_DELAY);
+    _pushPending = false;
+    _waitUs     += micros() - start;
+}
+
+// -----------------------------------------------
+
+void FrameSprite::pushTask(void *param)
+{
+    FrameSprite *sprite = (FrameSprite *)param;
+
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        // pipelined: fill the handed over list first, while the loop records the next one
+        if (sprite->_sendList != NULL)
+        {
+            uint32_t     fillStart = micros();
+            DisplayList *list      = sprite->_sendList;
+
+            replayBand(list->data, list->bytes, sprite->_layer, sprite->_img8, (sprite->_iwidth * sprite->_bpp) >> 3,
+                       sprite->_bpp, 0, sprite->_iheight);
+            sprite->_sendList           = NULL;
+            sprite->lastPush.rasterUs  += micros() - fillStart;
+            sprite->lastPush.pixels     = sprite->collectDirty(sprite->_sendDamage, sprite->_sendForced, sprite->_sendDirty, 0,
+                                                               (sprite->_iheight + FRAME_TILE_SIZE - 1) >> FRAME_TILE_SHIFT);
+        }
+
+        uint32_t start = micros();
+        bool     swap  = sprite->_tft->getSwapBytes();
+
+        sprite->_tft->setSwapBytes(false); // the colour table is already in SPI byte order
+        sprite->_tft->startWrite();
+        sprite->_convertUs = 0;
+        sprite->sendDirty(sprite->_sendDirty);
+        sprite->_tft->dmaWait();
+        sprite->_tft->endWrite();
+        sprite->_tft->setSwapBytes(swap);
+
+        sprite->lastPush.rects     = sprite->_rects;
+        sprite->lastPush.sendUs    = micros() - start;
+        sprite->lastPush.convertUs = sprite->_convertUs;
+        xSemaphoreGive(sprite->_pushDone);
+    }
+}
+
+// -----------------------------------------------
+
+// Convert a window a few lines at a time into the free line buffer and queue it.  Queuing
+// waits for the transfer before it, so the buffer filled next is never still on the wire.
+
+void FrameSprite::sendRect(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    if (_pushTaskHandle == NULL)
+    {
+        pushSprite(x, y, x, y - _stripTop, w, h);
+        return;
+    }
+
+    int32_t lines = (_iwidth * FRAME_DMA_LINES) / w;
+
+    for (int32_t top = y; top < y + h; top += lines)
+    {
+        int32_t count = y + h - top;
+        if (count > lines)
+            count = lines;
+
+        uint16_t      *buffer = _lineBuffer[_nextBuffer];
+        uint32_t      *out    = (uint32_t *)buffer;
+        uint32_t       stride = (_iwidth * _bpp) >> 3;
+        const uint8_t *line   = _img8 + (top - _stripTop) * stride + ((x * _bpp) >> 3);
+        uint32_t       start  = micros();
+        _nextBuffer ^= 1;
+
+        // windows start on a tile, so on the high nibble, and are an even width
+        for (int32_t j = 0; j < count; j++)
+        {
+            if (_bpp == 4)
+                convertLine4(line, out, _pairTable, w >> 1);
+            else
+                convertLine8(line, out, _colorTable, w);
+            out  += w >> 1;
+            line += stride;
+        }
+        _convertUs += micros() - start;
+
+        _tft->pushImageDMA(x, top, w, count, buffer);
+    }
+}
+
+#else
+
+bool FrameSprite::beginDMA()
+{
+    return false;
+}
+
+void FrameSprite::waitPush()
+{
+}
+
+void FrameSprite::buildColorTable()
+{
+}
+
+void FrameSprite::sendRect(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    pushSprite(x, y, x, y - _stripTop, w, h);
+}
+
+#endif
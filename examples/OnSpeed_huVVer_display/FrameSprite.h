@@ -0,0 +1,170 @@
+/*
+  FrameSprite.h - full screen sprite that pushes only the 16x16 tiles that changed.
+
+  The draw overrides mark the tiles they touch; pushFrame() sends the changed ones through
+  partial address windows.  Clear the sprite only with fillSprite(TFT_BLACK) or clear(),
+  send every frame with pushFrame(), call fence() before writing the buffer directly and
+  invalidate() after writing the panel some other way.  Optional: a static layer
+  (saveLayer/restoreLayer), DMA push on core 0 (beginDMA), draws recorded into display lists
+  (beginBands) and filled whole or in strips (beginStrips), a 4 bit palette with recolourable slots,
+  and captured draws for replay (Widget.h).  In strip mode the buffer holds FRAME_STRIP_LINES
+  lines: TFT_eSprite calls that use the whole buffer (fillSprite, readPixel, pushImage into the
+  sprite) run past its end, draw through the overrides only.
+*/
+
+#ifndef _FRAMESPRITE_H_
+#define _FRAMESPRITE_H_
+
+#include <TFT_eSPI.h>
+#include "DisplayList.h"
+#if defined(ARDUINO_ARCH_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#endif
+
+#define FRAME_TILE_SHIFT 4
+#define FRAME_TILE_SIZE (1 << FRAME_TILE_SHIFT)
+#define FRAME_TILE_ROWS 16 // enough for 256 lines
+#define FRAME_TILE_COLS 32 // one bit per tile column, enough for 512 pixels
+#define FRAME_DMA_LINES 8  // sprite lines per DMA line buffer
+#define FRAME_LIST_BYTES 12288 // each of the two display lists, filled early when full
+#define FRAME_PALETTE_COLORS 16 // 4 bit sprite
+#define FRAME_STRIP_LINES 32 // lines of the strip buffer, a multiple of FRAME_TILE_SIZE
+#define FRAME_SLOT_COLOR(n) ((uint16_t)(0x0020 + (n))) // draws into palette slot n, never a real colour
+
+struct FramePushStats
+{
+    uint32_t pixels; // pixels sent to the panel
+    uint32_t pushUs; // CPU time in pushFrame(): checking tiles, and sending them without DMA
+    uint32_t waitUs; // CPU time blocked in fence() before this push
+    uint32_t sendUs; // duration of the last completed DMA push
+    uint32_t rasterUs; // time filling the display list into the frame buffer this frame
+    uint32_t convertUs; // DMA push: time converting pixels to panel colours in the last completed push
+    uint16_t rects;  // partial windows used by the last completed push
+};
+
+class FrameSprite : public TFT_eSprite
+{
+public:
+    explicit FrameSprite(TFT_eSPI *tft);
+
+    void drawPixel(int32_t x, int32_t y, uint32_t color) override;
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) override;
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) override;
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override;
+
+    void invalidate(); // panel content unknown, the next push sends every tile
+    void pushFrame();  // send the tiles that changed since the last push
+
+    bool beginDMA(); // start DMA pushes, false if unavailable, pushes then block as before
+    void fence();    // apply recorded draws and wait for the push, the buffer may then be written
+
+    bool beginBands(uint32_t listBytes); // record draws, fill them at the push
+    void setBanded(bool banded);         // switch between recording and immediate drawing
+    bool banded() { return _banded; }
+    void clear();                        // start a frame from black
+    void dumpList(Print &out);           // the draws recorded so far, as text
+
+    bool beginStrips(uint16_t lines); // after beginBands(): free the frame buffer, push in strips
+    bool endStrips();                 // full frame buffer again, false if it cannot be allocated
+    uint16_t strips() { return _stripLines; } // lines per strip, 0 with the full frame buffer
+
+    bool beginCapture(); // false unless recording
+    bool endCapture(uint8_t *draws, uint32_t size, uint32_t &bytes); // false if filled early or larger than size
+    void replay(const uint8_t *draws, uint32_t bytes); // record captured draws again
+
+    bool beginOffscreen(uint8_t *draws, uint32_t size, const uint16_t *palette); // record into draws only
+    bool endOffscreen(uint32_t &bytes); // false if the draws did not fit
+
+    bool setPalette(const uint16_t *palette); // 4 bit only, FRAME_PALETTE_COLORS entries, 0 black, kept by pointer
+    bool setSlotColor(uint8_t index, uint16_t color); // false if the entry is not a slot of the palette
+    bool setExactColors(const uint16_t *colors, uint8_t count); // 8 bit only, kept by pointer
+    uint16_t shownColor(uint16_t color); // the RGB565 colour the panel shows for color drawn here
+
+    bool createLayer();  // allocate the static layer, false if there is not enough heap
+    void deleteLayer();
+    bool hasLayer() { return _layer != NULL; }
+    void saveLayer();    // current sprite content becomes the static layer
+    void restoreLayer(); // start a frame from the static layer
+
+    FramePushStats lastPush;
+    uint32_t       paletteMisses; // 4 bit: draws in a colour not in the palette
+    uint32_t       listOverflows; // strip mode: draws lost because both display lists were full
+
+private:
+    bool clip(int32_t &x, int32_t &y, int32_t &w, int32_t &h);
+    void damage(int32_t x, int32_t y, int32_t w, int32_t h);
+    void markTiles(int32_t x, int32_t y, int32_t w, int32_t h);
+    void fill(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    bool recording() { return _banded || _stripLines != 0; }
+    bool viaFill() { return recording() || _offscreen.data != NULL || _bpp == 4; } // draw overrides go through fill()
+    void markSlot(uint8_t pixel, int32_t x, int32_t y, int32_t w, int32_t h);
+    static uint16_t slotMask(const uint16_t *palette);
+    bool listFull();
+    uint8_t colorIndex(uint32_t color);
+    void buildColorTable();
+    void applySlots();
+    void flushBands();
+    void waitPush();
+    uint32_t tileHash(int16_t row, int16_t col, bool &blank);
+    uint32_t collectDirty(const uint32_t *damage, const uint32_t *forced, uint32_t *dirty, int32_t firstRow, int32_t endRow);
+    uint32_t bufferSize() { return ((uint32_t)_iwidth * _iheight * _bpp) >> 3; }
+    void sendDirty(uint32_t *dirty);
+    void pushStrips();
+    void setBuffer(uint8_t *buffer); // frame or strip buffer, freed by deleteSprite()
+    void sendRect(int32_t x, int32_t y, int32_t w, int32_t h);
+
+    uint32_t _damage[FRAME_TILE_ROWS];     // tiles drawn this frame
+    uint32_t _shown[FRAME_TILE_ROWS];      // tiles not black on the panel
+    uint32_t _forced[FRAME_TILE_ROWS];     // tiles to send regardless of checksum
+    uint32_t _panelHash[FRAME_TILE_ROWS][FRAME_TILE_COLS];
+
+    uint8_t *_layer;                       // static layer, NULL if not allocated
+    uint32_t _layerMask[FRAME_TILE_ROWS];  // tiles not black in the static layer
+
+    uint32_t _waitUs;   // fence() time since the last push
+    uint32_t _convertUs; // sendRect() time converting pixels in this push
+    uint16_t _rects;
+
+    DisplayList  _lists[2]; // one recording, the other with the push task when pipelined
+    uint8_t      _recording;
+    bool         _banded;
+    uint32_t     _rasterUs; // flushBands() time since the last push
+    DisplayList *_captureList; // list being captured from, NULL when the capture is lost
+    uint32_t     _captureStart;
+    DisplayList  _offscreen;     // between beginOffscreen() and endOffscreen(), otherwise detached
+    bool         _offscreenFull;
+    uint16_t     _stripLines; // strip mode: lines in the buffer, 0 with the full frame buffer
+    int32_t      _stripTop;   // frame line held by the first line of the buffer
+
+    const uint16_t *_palette;  // 4 bit colours, NULL until setPalette()
+    const uint16_t *_framePalette; // set again by endOffscreen()
+    uint32_t        _lastColor; // last colour looked up in the palette and its index
+    uint8_t         _lastIndex;
+    uint16_t        _slots;                     // palette entries that are slots
+    uint16_t        _slotsChanged;              // slots with a colour waiting for the next push
+    uint16_t        _slotColor[FRAME_PALETTE_COLORS];
+    uint32_t        _slotTiles[FRAME_PALETTE_COLORS][FRAME_TILE_ROWS]; // tiles drawn in each slot this frame
+    uint32_t        _layerSlots[FRAME_PALETTE_COLORS][FRAME_TILE_ROWS]; // and in the static layer
+    const uint16_t *_exactColors;               // 8 bit colours with their own colour table entry
+    uint8_t         _exactCount;
+
+#if defined(ARDUINO_ARCH_ESP32)
+    static void pushTask(void *param);
+
+    uint16_t         *_lineBuffer[2];                // DMA capable, FRAME_DMA_LINES sprite lines each
+    uint8_t           _nextBuffer;
+    uint16_t          _colorTable[256];              // pixel value to byte swapped 565
+    uint32_t          _pairTable[256];               // 4 bit: both pixels of a byte, see PixelConvert.h
+    uint32_t          _sendDirty[FRAME_TILE_ROWS];   // tiles handed to the push task
+    uint32_t          _sendDamage[FRAME_TILE_ROWS];  // pipelined: tiles drawn by the handed over list
+    uint32_t          _sendForced[FRAME_TILE_ROWS];
+    DisplayList      *_sendList;                     // pipelined: list to fill before sending, or NULL
+    TaskHandle_t      _pushTaskHandle;
+    SemaphoreHandle_t _pushDone;
+    bool              _pushPending;                  // handed over and not yet fenced
+#endif
+};
+
+#endif // _FRAMESPRITE_H_
@@ -0,0 +1,67 @@
+/*
+  FrameStats.h - achieved frame rate, render time and panel traffic, measured over one second
+  windows.
+*/
+
+#ifndef _FRAMESTATS_H_
+#define _FRAMESTATS_H_
+
+#include <stdint.h>
+
+#define FRAME_STATS_WINDOW 1000000 // us
+
+class FrameStats
+{
+public:
+    FrameStats() : fps(0), avgRenderUs(0), maxRenderUs(0), avgPixels(0), avgPushUs(0), avgWaitUs(0),
+                   _windowStart(0), _frames(0), _renderSum(0), _renderMax(0), _pixelSum(0), _pushSum(0), _waitSum(0) {}
+
+    // call once per pushed frame; returns true when a new window has been completed
+    bool frame(uint32_t nowUs, uint32_t renderUs, uint32_t pixels, uint32_t pushUs, uint32_t waitUs)
+    {
+        _frames++;
+        _renderSum += renderUs;
+        _pixelSum  += pixels;
+        _pushSum   += pushUs;
+        _waitSum   += waitUs;
+        if (renderUs > _renderMax)
+            _renderMax = renderUs;
+
+        uint32_t elapsed = nowUs - _windowStart;
+        if (elapsed < FRAME_STATS_WINDOW)
+            return false;
+
+        fps          = _frames * 1000000.0f / elapsed;
+        avgRenderUs  = _renderSum / _frames;
+        maxRenderUs  = _renderMax;
+        avgPixels    = _pixelSum / _frames;
+        avgPushUs    = _pushSum / _frames;
+        avgWaitUs    = _waitSum / _frames;
+        _windowStart = nowUs;
+        _frames      = 0;
+        _renderSum   = 0;
+        _renderMax   = 0;
+        _pixelSum    = 0;
+        _pushSum     = 0;
+        _waitSum     = 0;
+        return true;
+    }
+
+    float    fps;         // frames per second over the last window
+    uint32_t avgRenderUs; // mean render + push time over the last window
+    uint32_t maxRenderUs; // worst render + push time over the last window
+    uint32_t avgPixels;   // mean pixels sent to the panel per frame
+    uint32_t avgPushUs;   // mean time spent in the push per frame
+    uint32_t avgWaitUs;   // mean time the CPU waited for the previous push per frame
+
+private:
+    uint32_t _windowStart;
+    uint32_t _frames;
+    uint32_t _renderSum;
+    uint32_t _renderMax;
+    uint32_t _pixelSum;
+    uint32_t _pushSum;
+    uint32_t _waitSum;
+};
+
+#endif // _FRAMESTATS_H_
@@ -23,6 +23,11 @@ OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 // #define SERIALDATADEBUG   // show serial packet debug
 // #define DUMMY_SERIAL_DATA // dummy serial data for display test
 // #define IAS_IN_MPH        // uncomment this line for IAS in MPH, otherwise it will display in Kts;
+// #define ONSPEED_TONES     // generate backup OnSpeed AOA tones on the DAC audio outputs
+// #define FRAME_INTERPOLATION // render AOA, slip and attitude between serial frames at the full frame rate
+// #define FRAMESTATSDEBUG   // show achieved frame rate and render time
+// #define FRAME_4BPP        // 4 bit frame buffer with a palette per page, half the memory
+// #define GLOAD_SCROLL      // move the G load plot with the panel's scroll area, without the page title
 
 // #define REPEATER_MODE       // Used to turn on settings for video recorder repeater
 // #define VAC_MODE            // Used to turn on Vac specific features
@@ -44,6 +49,17 @@ OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <TFT_eSPI.h> // resident ESP Arduino libary, enable in library manager
 #include "GaugeWidgets.h"
 #include "Button.h"
+#include "FrameInterp.h"
+#include "FrameStats.h"
+#include "FrameScheduler.h"
+#include "EnergyRate.h"
+#include "FrameSprite.h"
+#include "Widget.h"
+#include "QualityGovernor.h"
+#include "PanelScroll.h"
+#include "StripChart.h"
+#include "Symbol.h"
+#include "ScreenText.h"
 
 #include <WiFi.h>
 #include <WiFiClient.h>
@@ -52,6 +68,9 @@ OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <Update.h>
 #include <Preferences.h>
 #include "SerialRead.h"
+#if defined(ONSPEED_TONES)
+#include "ToneGen.h"
+#endif
 
 // The following library must also be installed using the Arduino library manager
 // https://github.com/jmderomedi/SavitzkyGolayFilter
@@ -77,7 +96,8 @@ uint8_t aiIP[4] = {192, 168, 0, 2};
 #define TFT_LIGHT_BLUE 0x421F // 01000 010000 11111 0100001000011111
 
 TFT_eSPI tft = TFT_eSPI();
-TFT_eSprite gdraw = TFT_eSprite(&tft);
+FrameSprite frameSprite = FrameSprite(&tft); // pushes only the tiles that changed
+TFT_eSprite &gdraw = frameSprite;
 
 Gauges myGauges;
 
@@ -89,6 +109,16 @@ Button BackBtn = Button(BUTTON_D, true, DEBOUNCE_MS);
 Button X1Btn = Button(BUTTON_X1, true, DEBOUNCE_MS); // Assigns external X1 pin as a digital button input
 Button X2Btn = Button(BUTTON_X2, true, DEBOUNCE_MS); // Assigns external X2 pin as a digital button input
 
+// Numeric readouts as the pages print them, shared by the draw and the page state
+struct Readouts
+{
+    char pitch[8];
+    char g[8];
+    char palt[12];
+    char decel[8];
+    char ps[8];
+};
+
 void ButtonUpdate()
 {
     MenuBtn.read();   
@@ -113,9 +143,14 @@ float AOAThresholds[8]; // old % based tresholds= {0, 39, 41, 55, 65, 66, 79, 80
 // screen size variables
 const uint16_t WIDTH = 320;  // X
 const uint16_t HEIGHT = 240; // Y
+#if defined(FRAME_4BPP)
+const uint8_t FRAME_DEPTH = 4; // bits per frame buffer pixel
+#else
+const uint8_t FRAME_DEPTH = 8;
+#endif
+const uint32_t FRAME_BYTES = (uint32_t)WIDTH * HEIGHT * FRAME_DEPTH / 8;
 
 // display variables
-uint64_t loopTime = millis();
 uint64_t currentMillis;
 uint64_t previousMillis = millis();
 uint64_t flashTime = millis();
@@ -131,7 +166,8 @@ int16_t displayType = 0;
 #endif
 boolean numericDisplay;
 boolean flashFlag;
-const uint16_t updateRateGraphics = 100; // milliseconds
+boolean serialStale = true;
+const uint16_t updateRateGraphics = 16;  // milliseconds, shortest frame period, frames are rendered on new data and animation
 const uint16_t updateRateNumbers = 500;  // milliseconds
 const uint16_t flashRate = 250;          // milliseconds
 const float aoaSmoothingAlpha = 0.7;     // 1 = max smoothing, 0.01 no smoothing.
@@ -139,6 +175,7 @@ const float slipSmoothingAlpha = 0.5;    // 1 = max smoothing, 0.01 no smoothing
 const float decelSmoothingAlpha = 0.04;  // 1 = max smoothing, 0.01 no smoothing.
 
 const float serialRate = 0.1f; // 10 Hz;
+EnergyRate energyRate(10);     // Ps, updated at the serial rate
 //
 // AOA widget variables and defaults
 //
@@ -191,6 +228,28 @@ float SmoothedDecelRate = 0.0;
 float gHistory[300];
 int gHistoryIndex = 0;
 
+// G load history plot: newest sample on the left, one column per sample, 1 G every 26.67 lines
+const int16_t gPlotLeft = 20;
+const int16_t gGridY[] = { 27, 53, 80, 106, 160, 186, 213 }; // 5 G to -2 G, less the 1 G line
+const int16_t gOneY = 133;
+StripChart gChart(gPlotLeft, WIDTH - gPlotLeft, 160, 26.67, 0, HEIGHT - 1, 2); // gHistory as a line
+
+// hardware scrolled G plot, see scrollPage()
+PanelScroll panelScroll(&tft);
+TFT_eSprite gColumn(&tft); // the plot's left column
+int gScrollIndex = 0;      // gHistoryIndex drawn last
+
+// render-rate values, interpolated between serial frames
+FrameInterp frameInterp;
+FrameSample renderFrame;
+FrameStats frameStats;
+FrameScheduler frameScheduler(updateRateGraphics * 1000);
+
+// detail dropped when frames take longer than the scheduler allows at its shortest period
+QualityGovernor qualityGovernor(updateRateGraphics * 1000 * FRAME_CPU_SHARE / 100);
+const uint8_t qualityLabelStep[QUALITY_LEVELS] = { 10, 20, 20, 0 }; // degrees between pitch ladder labels, 0 for none
+const uint8_t qualityNoOutlines = 2;                                  // black outline passes skipped from this level on
+
 // number display variables
 float displayIAS = 0.0;
 float displayPalt = 0.0;
@@ -198,6 +257,29 @@ float displayPitch = 0.0;
 float displayVerticalG = 0.0;
 int displayPercentLift = 0;
 float displayDecelRate = 0.0;
+int16_t displayPs = 0;
+
+// regions of the AOA pages drawn only when what they show changes, see Widget.h
+Widget aoaWidget("AOA", 6144, 0);
+Widget liftWidget("lift", 6144, 0);
+Widget iasWidget("IAS", 1536, 0);
+Widget gWidget("G", 2048, 0);
+Widget flapWidget("flaps", 2048, 0);
+Widget slipWidget("slip", 1024, 0);
+Widget gOnsetWidget("gOnset", 1024, 0);
+Widget *const widgets[] = { &aoaWidget, &liftWidget, &iasWidget, &gWidget, &flapWidget, &slipWidget, &gOnsetWidget };
+const int16_t widgetCount = sizeof(widgets) / sizeof(widgets[0]);
+
+// fixed shapes kept as runs of pixels, boxes around their anchors, see Symbol.h
+Symbol planeOutlinedSymbol("plane", drawPlaneOutlined, -100, -6, 201, 35);
+Symbol planeSymbol("plane filled", drawPlaneFilled, -100, -6, 201, 35);
+Symbol pointerOutlinedSymbol("pointer", drawTopPointerOutlined, -7, -93, 15, 24);
+Symbol pointerSymbol("pointer filled", drawTopPointerFilled, -7, -93, 15, 24);
+Symbol flightPathSymbol("flight path", drawFlightPath, -33, -33, 67, 48);
+Symbol noDataSymbol("no data", drawNoData, 0, 0, WIDTH, HEIGHT);
+Symbol *const symbols[] = { &planeOutlinedSymbol, &planeSymbol, &pointerOutlinedSymbol, &pointerSymbol, &flightPathSymbol,
+                            &noDataSymbol };
+const int16_t symbolCount = sizeof(symbols) / sizeof(symbols[0]);
 
 double iasDerivativeInput;
 // SavLayFilter iasDerivative(&iasDerivativeInput, 1, 15); // Computes the first derivative
@@ -210,12 +292,112 @@ unsigned int selectedPort = 0; // selected serial port
 void drawAOA(uint16_t X0, uint16_t Y0, uint16_t W, uint16_t H, float AOA, boolean flashFlag, float Array[]);    // function to draw AOA widget
 void drawSlip(uint16_t X0, uint16_t Y0, uint16_t W, uint16_t H, int16_t Yaw, boolean flashFlag, float Array[]); // function to draw Slip widget
 
+//
+// Display pages
+//
+void aoaPageStatic();
+void aoaPage();
+void narrowAOAPageStatic();
+void narrowAOAPage();
+void displayAttitude();
+void displayDecelStatic();
+void displayDecelGauge();
+void displayGloadStatic();
+void displayGloadHistory();
+void displayGloadDots();
+uint32_t aoaPageState();
+uint32_t narrowAOAPageState();
+uint32_t attitudePageState();
+uint32_t decelPageState();
+uint32_t gloadPageState();
+
+//
+// Symbols, see Symbol.h
+//
+void drawPlaneOutlined(TFT_eSPI &out, int16_t x, int16_t y);
+void drawPlaneFilled(TFT_eSPI &out, int16_t x, int16_t y);
+void drawTopPointerOutlined(TFT_eSPI &out, int16_t x, int16_t y);
+void drawTopPointerFilled(TFT_eSPI &out, int16_t x, int16_t y);
+void drawFlightPath(TFT_eSPI &out, int16_t x, int16_t y);
+void drawNoData(TFT_eSPI &out, int16_t x, int16_t y);
+
+// Colours of the 4 bit frame buffer, entry 0 must be black.  Anything else is drawn in the
+// nearest entry.
+const uint16_t pagePalette[FRAME_PALETTE_COLORS] = {
+    TFT_BLACK, TFT_WHITE, TFT_LIGHTGREY, TFT_DARKGREY, TFT_RED, TFT_YELLOW, TFT_GREEN, TFT_ORANGE,
+    TFT_LIGHT_BLUE, TFT_MAGENTA, TFT_CYAN, TFT_BLUE, 0x8281 /* ground brown */, TFT_BLACK, TFT_BLACK, TFT_BLACK,
+};
+
+// Colours RGB332 cannot show, given their own entries in the 8 bit frame buffer's colour table
+const uint16_t exactColors[] = { TFT_LIGHTGREY, TFT_DARKGREY, TFT_LIGHT_BLUE, 0x8281 /* ground brown */ };
+
+// The AOA indicator shapes only change colour with the AOA state, and the slip ball with the
+// stall flash.  In a 4 bit build they are drawn in palette slots, and the state is shown by
+// recolouring the slots at push time.
+enum AOAShape
+{
+    AOA_TOP_CHEVRON,
+    AOA_BOTTOM_CHEVRON,
+    AOA_BOTTOM_ARC,
+    AOA_TOP_ARC,
+    AOA_CENTER_DOT,
+    AOA_SHAPES,
+};
+const uint8_t AOA_SLOT_FIRST = 10;                       // palette slot of the first shape
+const uint8_t SLIP_BALL_SLOT = AOA_SLOT_FIRST + AOA_SHAPES;
+
+const uint16_t aoaPalette[FRAME_PALETTE_COLORS] = {
+    TFT_BLACK, TFT_WHITE, TFT_LIGHTGREY, TFT_DARKGREY, TFT_RED, TFT_YELLOW, TFT_GREEN, TFT_ORANGE,
+    TFT_LIGHT_BLUE, TFT_MAGENTA, FRAME_SLOT_COLOR(10), FRAME_SLOT_COLOR(11), FRAME_SLOT_COLOR(12),
+    FRAME_SLOT_COLOR(13), FRAME_SLOT_COLOR(14), FRAME_SLOT_COLOR(15),
+};
+
+struct DisplayPage
+{
+    void (*drawStatic)();     // constant parts, drawn once into the static layer, NULL if none
+    void (*drawDynamic)();    // everything else, drawn every frame on top
+    uint32_t (*state)();      // hash of what drawDynamic shows at display resolution, NULL to render every frame
+    const uint16_t *palette;  // FRAME_4BPP colours
+    bool strips;              // rendered in strips, without the frame buffer or the static layer
+    bool scrolled;            // moved with the panel's scroll area after the first frame, see scrollPage()
+};
+
+#if defined(GLOAD_SCROLL)
+const bool gPlotScrolled = true; // G load plot in the panel's scroll area, or redrawn every frame
+#else
+const bool gPlotScrolled = false;
+#endif
+
+const DisplayPage displayPages[] = {
+    { aoaPageStatic, aoaPage, aoaPageState, aoaPalette, false, false },                             // 0 default indicator with numeric display
+    { NULL, displayAttitude, attitudePageState, pagePalette, false, false },                        // 1 attitude indicator, the sky fill covers everything
+    { narrowAOAPageStatic, narrowAOAPage, narrowAOAPageState, aoaPalette, false, false },           // 2 narrow AOA and slip indicator
+    { displayDecelStatic, displayDecelGauge, decelPageState, pagePalette, false, false },           // 3 decel gauge
+    { displayGloadStatic, displayGloadHistory, gloadPageState, pagePalette, false, gPlotScrolled }, // 4 G load history
+};
+const int16_t displayPageCount = sizeof(displayPages) / sizeof(displayPages[0]);
+
+int16_t staticLayerPage = -1; // page held in the static layer, -1 if none
+bool stripsForced = false;    // every page rendered in strips, 's' on the console in FRAMESTATSDEBUG builds
+
+// static layers of the pages either side of the current one, recorded ahead in idle time so a
+// page switch only has to play them back (FrameSprite::beginOffscreen)
+const uint32_t backdropBytes = 16384;
+uint8_t *backdropDraws[2] = { NULL, NULL };
+uint32_t backdropSize[2] = { 0, 0 };
+int16_t backdropPage[2] = { -1, -1 };
+uint32_t backdropTooBig = 0;  // pages whose static draws do not fit, one bit each
+uint32_t pageSwitchStart = 0; // micros() of the page button, 0 once the new page is shown
+bool pageFromBackdrop = false;
+
 // -----------------------------------------------
 // setup()
 // -----------------------------------------------
 
 void setup()
 {
+    Serial.begin(115200); // console serial, early so boot messages are seen
+
     //
     // Preset outputs
     //
@@ -241,16 +423,30 @@ void setup()
     ledcAttachPin(TFT_LED_PIN, 4); // attach pin
     ledcWrite(4, 4095);
 
+#if defined(ONSPEED_TONES)
+    // OnSpeed tones on the DAC outputs, silent until valid serial data arrives
+    toneBegin();
+#else
     // mute the speaker (annoying hiss)
     digitalWrite(PIN_AUDL, LOW); // audio quiet
     digitalWrite(PIN_AUDR, LOW); // audio quiet
-    gdraw.setColorDepth(8);
-    gdraw.createSprite(WIDTH, HEIGHT);
+#endif
+    // the splash screen needs no frame buffer, show it straight away
+    displaySplashScreen();
+    uint32_t splashMs = millis();
+
+    // allocate the frame buffer once, before WiFi or anything else can fragment the heap
+    frameBufferSetup();
+#if defined(FRAMESTATSDEBUG)
+    benchmarkPages();
+#endif
     gdraw.fillSprite(TFT_BLACK);
     // prefill gHistory buffer
     for (int i = 0; i < 300; i++)
         gHistory[i] = 1.00;
-    displaySplashScreen();
+    gChart.fill(1.00, gPlotColour(1.00));
+    uint32_t setupMs = millis();
+    Serial.printf("Splash screen on the panel %u ms after reset, display set up at %u ms\n", splashMs, setupMs);
     // duration of splash screen display, check for center button for fw upgrade
     uint64_t waitTime = millis();
     while (millis() - waitTime < 5000)
@@ -261,9 +457,13 @@ void setup()
         if (MenuBtn.isPressed())
         {
             fwUpdateMode = true;
-            gdraw.setColorDepth(8);
-            gdraw.createSprite(WIDTH, HEIGHT);
-            gdraw.fillSprite(TFT_BLACK);
+            // WiFi needs the heap more than the display does in this mode
+            frameSprite.deleteLayer();
+            staticLayerPage = -1;
+            setStripMode(true);
+
+            // names and addresses that may change, always drawn
+            frameSprite.clear();
             gdraw.setFreeFont(FSSB12);
             gdraw.setTextColor(TFT_WHITE);
             gdraw.setTextDatum(MC_DATUM);
@@ -283,8 +483,7 @@ void setup()
             gdraw.setTextDatum(MR_DATUM);
             gdraw.drawString("EXIT", 280, 215);
 
-            gdraw.pushSprite(0, 0);
-            gdraw.deleteSprite();
+            frameSprite.pushFrame();
 
             WiFi.softAP(ssid, password);
             delay(100); // wait to init softAP
@@ -324,20 +523,7 @@ void setup()
                         { //start with max available size
                             //Update.printError(Serial);
                         }
-                        gdraw.setColorDepth(8);
-                        gdraw.createSprite(WIDTH, HEIGHT);
-                        gdraw.fillSprite (TFT_BLACK);
-                        gdraw.setFreeFont(FSSB12);
-                        gdraw.setTextColor (TFT_WHITE);
-
-                        gdraw.setTextDatum(MC_DATUM);
-                        gdraw.drawString("Upgrading Firmware",160,90);
-
-                        gdraw.setFreeFont(FSS12);
-                        gdraw.drawString("Please wait...",160,150);
-
-                        gdraw.pushSprite (0, 0);
-                        gdraw.deleteSprite();
+                        showScreen(SCREEN_UPGRADING);
                     }
 
                     else if (upload.status == UPLOAD_FILE_WRITE) 
@@ -377,7 +563,6 @@ void setup()
 #if !defined(DUMMY_SERIAL_DATA)
     // select serial port from preferences or detect it
     serialSetup();
-    Serial.begin(115200); // console serial
     delay(100);
 #endif
 
@@ -398,6 +583,8 @@ void loop()
         {
             fwUpdateMode = false;
             WiFi.softAPdisconnect(true);
+            setStripMode(false);
+            frameSprite.createLayer();
 #if !defined(DUMMY_SERIAL_DATA)
             serialSetup(); // firmware update canceled, set up serial port
 #endif
@@ -407,6 +594,13 @@ void loop()
 
     SerialRead(); // get serial data
 
+#if defined(ONSPEED_TONES)
+    if (millis() - serialMillis > 300)
+        toneMute(); // no tones on stale data
+    else
+        toneUpdate(SmoothedAOA, IAS, OnSpeedTonesOnAOA, OnSpeedFastAOA, OnSpeedSlowAOA, OnSpeedStallWarnAOA);
+#endif
+
     //
     // Restart
     //
@@ -436,28 +630,27 @@ void loop()
 
     if (BackBtn.wasPressed())
     {
-        gdraw.setColorDepth(8);
-        gdraw.createSprite(WIDTH, HEIGHT);
-        gdraw.fillSprite(TFT_BLACK);
         displayType--;
         if (displayType < 0)
-            displayType = 4; // type of display
+            displayType = displayPageCount - 1; // type of display
+        frameScheduler.request();
+        pageSwitchStart = micros();
     }
 
     if (FwdBtn.wasPressed())
     {
-        gdraw.setColorDepth(8);
-        gdraw.createSprite(WIDTH, HEIGHT);
-        gdraw.fillSprite(TFT_BLACK);
         displayType++;
-        if (displayType > 4)
+        if (displayType >= displayPageCount)
             displayType = 0; // type of display
+        frameScheduler.request();
+        pageSwitchStart = micros();
     }
 
     // update G history buffer
     if (millis() - gHistoryTime > 200)
     {
         gHistory[gHistoryIndex] = VerticalG;
+        gChart.add(VerticalG, gPlotColour(VerticalG));
         if (gHistoryIndex < 299)
             gHistoryIndex++;
         else
@@ -465,14 +658,28 @@ void loop()
         gHistoryTime = millis();
     }
 
+    // Frames are rendered for new serial data (see SerialProcess()) and for anything else that moves
+    if (serialStale != (millis() - serialMillis > 300))
+    {
+        serialStale = !serialStale; // show or clear the NO DATA screen
+        frameScheduler.request();
+    }
+#if defined(FRAME_INTERPOLATION)
+    if (frameInterp.blending(millis()))
+        frameScheduler.request();
+#endif
+
     // Update graphics
-    if (millis() > (loopTime + updateRateGraphics))
+    if (frameScheduler.due(micros()))
     {
-        loopTime = millis();
+        uint32_t frameStart = micros();
+        frameScheduler.begin(frameStart);
 
-        gdraw.setColorDepth(8);
-        gdraw.createSprite(WIDTH, HEIGHT);
-        gdraw.fillSprite(TFT_BLACK);
+#if defined(FRAME_INTERPOLATION)
+        frameInterp.sample(millis(), renderFrame);
+#else
+        frameInterp.latest(renderFrame);
+#endif
 
         // update numbers at a slower rate so they are readable
         if (millis() - numbersUpdateTime > updateRateNumbers)
@@ -487,206 +694,531 @@ void loop()
             displayVerticalG = VerticalG;
             displayPercentLift = PercentLift;
             displayDecelRate = SmoothedDecelRate;
+            displayPs = energyRate.psFpm;
             numbersUpdateTime = millis();
         } // end if update numbers
 
-        /*
-        Main AOA alarm detection & update AOA display
-        */
-        switch (displayType)
+        // Nothing visible changed since the last frame: no render and no push
+        bool skipped = millis() - serialMillis <= 300 && frameScheduler.unchanged(pageState());
+        if (skipped)
+            frameScheduler.skip();
+        else
         {
-        case 0: // 0 default indicator with numeric display
+            /*
+            Main AOA alarm detection & update AOA display
+            */
+            bool scrolled = millis() - serialMillis <= 300 && scrollPage();
+            if (!scrolled)
+                renderPage(true);
+
+            // Look for serial link failure
+            // Draw red lines across display
+            if (millis() - serialMillis > 300)
+            {
+                endScroll();
+                frameScheduler.forget();
+                frameSprite.clear();
+                noDataSymbol.draw(gdraw, 0, 0);
+
+                frameSprite.pushFrame();
+                frameScheduler.end(micros());
+                return;
+            } // end if serial data timeout
+
+#if defined(FRAMESTATSDEBUG)
+            if (!scrolled)
+                drawFrameStats();
+
+            // 'd' on the console dumps this frame's display list, see extras/host/DisplayListReplay.cpp;
+            // 's' renders every page in strips from the next frame on, or the pages' own way again
+            int key = Serial.available() ? Serial.read() : -1;
+            if (key == 'd')
+                frameSprite.dumpList(Serial);
+            else if (key == 's')
+            {
+                stripsForced = !stripsForced;
+                frameScheduler.forget();
+            }
+#endif
+
+            if (!scrolled)
+                frameSprite.pushFrame();
+            frameScheduler.end(micros());
+            if (qualityGovernor.frame(micros() - frameStart))
+                setQuality(qualityGovernor.level);
+        }
+
+#if defined(FRAMESTATSDEBUG)
+        if (pageSwitchStart != 0)
         {
-            wgtWidth = 102;
-            wgtHeight = 192;
-            wgtX0 = (WIDTH - wgtWidth) / 2;
-            wgtY0 = 0;
-            numericDisplay = true;
-            displayAOA();
-            break;
+            uint32_t latency = micros() - pageSwitchStart;
+            Serial.printf("Page %d shown %u us after the button, static layer %s\n", displayType, latency,
+                          pageFromBackdrop ? "rendered ahead" : "drawn");
+            pageSwitchStart = 0;
         }
 
-        case 1:
+        if (frameScheduler.report(micros()))
         {
-            // display Attitude Indicator
-            AiGraph(px0, py0, arcSize, arcWidth, maxDisplay, minDisplay, startAngle, arcAngle, clockWise,
-                    gradMarks, int(Pitch), int(Roll), 360, FlightPath);
+            printFrameSchedule();
+            printWidgetStats();
+        }
+        if (!skipped && frameStats.frame(micros(), micros() - frameStart, frameSprite.lastPush.pixels,
+                                         frameSprite.lastPush.pushUs, frameSprite.lastPush.waitUs))
+        {
+            FramePushStats &push = frameSprite.lastPush;
+            Serial.printf("Display: %.1f fps, render+push avg %u us, max %u us, pushed avg %u px (%u%%) in %u us, "
+                          "SPI wait avg %u us, last DMA push %u px in %u us, converted at %.1f px/us\n",
+                          frameStats.fps, frameStats.avgRenderUs, frameStats.maxRenderUs,
+                          frameStats.avgPixels, frameStats.avgPixels * 100 / (WIDTH * HEIGHT), frameStats.avgPushUs,
+                          frameStats.avgWaitUs, push.pixels, push.sendUs,
+                          push.convertUs ? (float)push.pixels / push.convertUs : 0.0f);
+            if (frameSprite.strips())
+                Serial.printf("Strips: %u lines, last push %u us of which %u us filling the strips, %u draws lost\n",
+                              frameSprite.strips(), frameSprite.lastPush.pushUs, frameSprite.lastPush.rasterUs,
+                              frameSprite.listOverflows);
+        }
+#endif
+    } // end if time to update graphics
+    else
+        renderAhead();
 
-            // update numeric displays
-            // Update airspeed numeric display
-            // print labels
-            gdraw.setFreeFont(FSS12);
+    if (millis() - flashTime >= flashRate)
+    {
+        flashFlag = !flashFlag;
+        flashTime = millis();
+        if (!recolourFlash())
+            frameScheduler.request();
+    }
+} // end loop()
 
-            gdraw.setCursor(5, 60);
-            gdraw.setTextColor(TFT_LIGHTGREY);
-            gdraw.print("IAS");
+// -----------------------------------------------
 
-            gdraw.setCursor(5, 230);
-            gdraw.setTextColor(TFT_LIGHTGREY);
-            gdraw.print("G");
+// In a 4 bit build the AOA pages flash only palette slots: recolour them and push, without
+// drawing anything.  false if the page has to be rendered for the flash.
 
-            gdraw.setCursor(243, 60);
-            gdraw.setTextColor(TFT_LIGHTGREY);
-            gdraw.print("P-ALT");
+bool recolourFlash()
+{
+#if defined(FRAME_4BPP)
+    if (serialStale)
+        return false; // NO DATA screen
+
+    uint16_t colours[AOA_SHAPES];
+    aoaColours(renderFrame.AOA, flashFlag, AOAThresholds, colours);
+    if (!frameSprite.setSlotColor(AOA_SLOT_FIRST + AOA_TOP_CHEVRON, colours[AOA_TOP_CHEVRON]))
+        return false; // not an AOA page, or its palette is not set yet
+
+    frameSprite.setSlotColor(SLIP_BALL_SLOT, slipColour(lroundf(renderFrame.Slip), flashFlag, AOAThresholds));
+    frameSprite.pushFrame();
+    return true;
+#else
+    return false;
+#endif
+}
 
-            gdraw.setCursor(260, 230);
-            gdraw.setTextColor(TFT_LIGHTGREY);
-            gdraw.print("AOA");
+// -----------------------------------------------
 
-            // update numeric pitch display
-            // same font as labels
-            // dark background for pitch readability
-            gdraw.fillRoundRect(55, 129, 56, 21, 3, TFT_LIGHTGREY);
+// Achieved frame rate readout in the top left corner
 
-            gdraw.setTextColor(TFT_WHITE);
-            char PitchStr[4];
-            sprintf(PitchStr, "%1.1f", displayPitch);
-            gdraw.setTextDatum(MR_DATUM);
-            gdraw.drawString(PitchStr, 100, 138);
-            // draw degree symbol
-            gdraw.drawCircle(106, 132, 0.50f * 5, TFT_WHITE);
+void drawFrameStats()
+{
+    char fpsStr[12];
+    frameStatsText(fpsStr);
+    gdraw.setTextFont(1);
+    gdraw.setTextColor(TFT_WHITE, TFT_BLACK);
+    gdraw.setTextDatum(TL_DATUM);
+    gdraw.drawString(fpsStr, 0, 0);
+}
 
-            gdraw.setFreeFont(FSSB18);
-            gdraw.setTextColor(TFT_BLACK);
-            gdraw.setCursor(5, 30);
-            gdraw.print(int(displayIAS));
+void frameStatsText(char text[12])
+{
+    sprintf(text, "%.0f fps", frameStats.fps);
+}
 
-            // Update G-force numeric display
-            // gdraw.setFreeFont(FSSB18);
-            gdraw.setTextColor(TFT_WHITE);
-            gdraw.setCursor(5, 200);
-            gdraw.printf("%+1.1f", displayVerticalG);
+// -----------------------------------------------
 
-            // Update pressure altitude numeric display
-            // gdraw.setFreeFont(FSSB18);
-            gdraw.setTextColor(TFT_BLACK);
-            gdraw.setTextDatum(MR_DATUM);
-            char PressAltStr[10];
-            sprintf(PressAltStr, "%5.0f", displayPalt);
-            gdraw.drawString(PressAltStr, 309, 18);
+// Frame scheduling histograms, printed every FRAME_REPORT_PERIOD
 
-            // Update AOA numeric display
-            // gdraw.setFreeFont(FSSB18);
-            gdraw.setTextColor(TFT_WHITE);
-            gdraw.setCursor(269, 200);
-            gdraw.printf("%02d", displayPercentLift);
+void printFrameSchedule()
+{
+    uint32_t *wait = frameScheduler.waitHistogram;
+    uint32_t *fps = frameScheduler.fpsHistogram;
+
+    Serial.printf("Frame period %u us, render cost %u us\n", frameScheduler.periodUs, frameScheduler.costUs);
+    uint32_t due = frameScheduler.rendered + frameScheduler.skipped;
+    Serial.printf("Frames rendered %u, skipped unchanged %u (%u%%)\n", frameScheduler.rendered, frameScheduler.skipped,
+                  due ? frameScheduler.skipped * 100 / due : 0);
+    Serial.printf("Data to render wait ms: <2 %u, <5 %u, <10 %u, <20 %u, <50 %u, <100 %u, >=100 %u\n",
+                  wait[0], wait[1], wait[2], wait[3], wait[4], wait[5], wait[6]);
+    Serial.printf("Seconds at fps: <5 %u, <10 %u, <15 %u, <20 %u, <30 %u, <45 %u, >=45 %u\n",
+                  fps[0], fps[1], fps[2], fps[3], fps[4], fps[5], fps[6]);
+}
 
-            // Update ball display on attitude page
-            // Increase sensitivity of slip indicator
-            drawSlip(80, 204, 160, 20, Slip, false, AOAThresholds);
+// -----------------------------------------------
 
-            // iVSI
-            // draw iVSI line
-            if (iVSI != 0.0)
-            {
-                int vsiHeight = abs(int(iVSI * 120 / 600));
-                vsiHeight = constrain(vsiHeight, 0, 120);
-                int vsiTop;
-                if (iVSI > 0)
-                    vsiTop = 119 - vsiHeight;
-                else
-                    vsiTop = 119;
-                gdraw.fillRect(313, vsiTop, 7, vsiHeight, TFT_ORANGE);
-            }
+// Widgets drawn and replayed since the last report, with their average cost
 
-            // vsi ladder, every 20 pixels
-            for (int i = 19; i < 220; i = i + 20)
-            {
-                gdraw.drawLine(313, i, 319, i, TFT_BLACK);
-            }
+void printWidgetStats()
+{
+    for (int16_t i = 0; i < widgetCount; i++)
+    {
+        Widget &w = *widgets[i];
+        if (w.renders + w.replays == 0)
+            continue;
+        Serial.printf("Widget %s: drawn %u times avg %u us, replayed %u times avg %u us, %u of %u cache bytes, %u too big\n",
+                      w.name, w.renders, w.renders ? w.renderUs / w.renders : 0, w.replays,
+                      w.replays ? w.replayUs / w.replays : 0, w.drawBytes(), w.cacheSize(), w.overflows);
+        w.clearStats();
+    }
+    for (int16_t i = 0; i < symbolCount; i++)
+    {
+        Symbol &s = *symbols[i];
+        if (s.draws == 0)
+            continue;
+        Serial.printf("Symbol %s: drawn %u times avg %u us, %u runs\n", s.name, s.draws, s.drawUs / s.draws, s.runs());
+        s.clearStats();
+    }
+}
 
-            // zero line
-            gdraw.drawLine(306, 118, 312, 118, TFT_BLACK);
-            gdraw.drawLine(306, 119, 312, 119, TFT_BLACK);
-            gdraw.drawLine(306, 120, 312, 120, TFT_BLACK);
+// -----------------------------------------------
 
-            break;
-        }
+// Visible state of the current page for FrameScheduler::unchanged(), 0 if it has none
 
-        case 2: // 2 narrow AOA and slip indicator
-        {
-            wgtWidth = 102;
-            wgtHeight = 192;
-            wgtX0 = (WIDTH - wgtWidth) / 2;
-            wgtY0 = 0;
-            numericDisplay = false;
-            displayAOA();
-            break;
-        }
+uint32_t pageState()
+{
+    const DisplayPage &page = displayPages[displayType];
+    if (page.state == NULL)
+        return 0;
+    WidgetKey key;
+    key.add(displayType).add(qualityGovernor.level).add(page.state());
+#if defined(FRAMESTATSDEBUG)
+    char fpsStr[12];
+    frameStatsText(fpsStr);
+    key.addText(fpsStr); // the frame rate readout drawn over the page
+#endif
+    return key.value;
+}
 
-        case 3: // decel gauge
-        {
-            displayDecelGauge();
-            break;
-        }
+// -----------------------------------------------
+
+// Draw the current page into the frame buffer.  With the static layer the frame starts as a
+// copy of the page's constant parts, drawn when the page is entered; otherwise it starts black
+// and the constant parts are redrawn.
+
+void renderPage(bool useStaticLayer)
+{
+    static int16_t widgetPage = -1;
+    const DisplayPage &page = displayPages[displayType];
+
+    if (widgetPage != displayType) // cached widget draws belong to the page's layout and palette
+    {
+        for (int16_t i = 0; i < widgetCount; i++)
+            widgets[i]->invalidate();
+        widgetPage = displayType;
+    }
+
+    setStripMode(page.strips || stripsForced);
+    frameSprite.setPalette(page.palette); // no effect unless the buffer is 4 bit and the palette changes
 
-        case 4:
+    if (useStaticLayer && page.drawStatic != NULL && frameSprite.hasLayer() && !frameSprite.strips())
+    {
+        if (staticLayerPage != displayType)
         {
-            displayGloadHistory();
-            break;
+            int16_t slot = backdropSlot(displayType);
+            pageFromBackdrop = slot >= 0;
+            if (pageFromBackdrop)
+                frameSprite.replay(backdropDraws[slot], backdropSize[slot]);
+            else
+            {
+                frameSprite.clear();
+                page.drawStatic();
+            }
+            frameSprite.saveLayer();
+            staticLayerPage = displayType;
         }
+        else
+            frameSprite.restoreLayer();
+    }
+    else
+    {
+        frameSprite.clear();
+        if (page.drawStatic != NULL)
+            page.drawStatic();
+    }
 
-        default:
-            break;
-        } // end switch on display type
+    page.drawDynamic();
+}
 
-        // Look for serial link failure
-        // Draw red lines across display
-        if (millis() - serialMillis > 300)
-        {
-            gdraw.fillSprite(TFT_BLACK);
-            gdraw.drawLine(0, 0, 319, 239, TFT_RED); // center
+// -----------------------------------------------
 
-            gdraw.drawLine(0, 1, 318, 239, TFT_RED); // left
-            gdraw.drawLine(0, 2, 317, 239, TFT_RED);
-            gdraw.drawLine(0, 3, 316, 239, TFT_RED);
-            gdraw.drawLine(0, 4, 315, 239, TFT_RED);
+// Render in strips of FRAME_STRIP_LINES, giving the frame buffer back to the heap, or with the
+// full frame buffer.  The frame buffer may not fit any more once WiFi has the heap, the page is
+// then still rendered in strips.
 
-            gdraw.drawLine(1, 0, 319, 238, TFT_RED); // right
-            gdraw.drawLine(2, 0, 319, 237, TFT_RED);
-            gdraw.drawLine(3, 0, 319, 236, TFT_RED);
-            gdraw.drawLine(4, 0, 319, 235, TFT_RED);
+void setStripMode(bool strips)
+{
+    static bool failed = false; // reported once, retried every frame
 
-            gdraw.drawLine(0, 239, 319, 0, TFT_RED); // center
+    if (strips == (frameSprite.strips() != 0))
+        return;
 
-            gdraw.drawLine(0, 238, 318, 0, TFT_RED); // left
-            gdraw.drawLine(0, 237, 317, 0, TFT_RED);
-            gdraw.drawLine(0, 236, 316, 0, TFT_RED);
-            gdraw.drawLine(0, 235, 315, 0, TFT_RED);
+    uint32_t heap = ESP.getFreeHeap();
+    if (strips ? frameSprite.beginStrips(FRAME_STRIP_LINES) : frameSprite.endStrips())
+    {
+        Serial.printf("Strip mode %s: %u line strips, %d bytes of heap %s, %u bytes left\n", strips ? "on" : "off",
+                      FRAME_STRIP_LINES, abs((int32_t)(ESP.getFreeHeap() - heap)), strips ? "freed" : "taken",
+                      ESP.getFreeHeap());
+        failed = false;
+    }
+    else if (!failed)
+    {
+        Serial.printf("Strip mode %s failed, %u bytes free, largest block %u\n", strips ? "on" : "off",
+                      ESP.getFreeHeap(), ESP.getMaxAllocHeap());
+        failed = true;
+    }
+}
 
-            gdraw.drawLine(1, 239, 319, 1, TFT_RED); // right
-            gdraw.drawLine(2, 239, 319, 2, TFT_RED);
-            gdraw.drawLine(3, 239, 319, 3, TFT_RED);
-            gdraw.drawLine(4, 239, 319, 4, TFT_RED);
+// -----------------------------------------------
 
-            gdraw.setFreeFont(FSSB18);
-            gdraw.setTextColor(TFT_WHITE);
-            gdraw.setTextDatum(MC_DATUM);
-            gdraw.fillRect(100, 100, 120, 40, TFT_BLACK);
-            gdraw.drawString("NO DATA", 160, 120);
+// Backdrop slot holding a page's static draws, -1 if none
 
-            gdraw.pushSprite(0, 0);
-            gdraw.deleteSprite();
+int16_t backdropSlot(int16_t pageIndex)
+{
+    for (int16_t i = 0; i < 2; i++)
+        if (backdropPage[i] == pageIndex)
+            return i;
+    return -1;
+}
+
+// Between frames, record the static layer of one neighbouring page that has none recorded yet.
+// A slot is reused once its page is no longer next to the current one.
+
+void renderAhead()
+{
+    if (!frameSprite.hasLayer())
+        return;
+
+    int16_t next[2] = { (int16_t)((displayType + 1) % displayPageCount),
+                        (int16_t)((displayType + displayPageCount - 1) % displayPageCount) };
+    for (int16_t i = 0; i < 2; i++)
+    {
+        int16_t pageIndex = next[i];
+        if (displayPages[pageIndex].drawStatic == NULL || backdropSlot(pageIndex) >= 0 ||
+            (backdropTooBig & (1UL << pageIndex)))
+            continue;
+
+        int16_t slot = backdropPage[0] == next[0] || backdropPage[0] == next[1] ? 1 : 0;
+        if (backdropDraws[slot] == NULL)
             return;
-        } // end if serial data timeout
 
-    } // end if time to update graphics
+#if defined(FRAMESTATSDEBUG)
+        uint32_t start = micros();
+#endif
+        frameSprite.beginOffscreen(backdropDraws[slot], backdropBytes, displayPages[pageIndex].palette);
+        frameSprite.clear();
+        displayPages[pageIndex].drawStatic();
+        bool fits = frameSprite.endOffscreen(backdropSize[slot]);
+        backdropPage[slot] = fits ? pageIndex : -1;
+        if (!fits)
+            backdropTooBig |= 1UL << pageIndex;
+#if defined(FRAMESTATSDEBUG)
+        uint32_t took = micros() - start;
+        Serial.printf("Page %d static layer rendered ahead in %u us: %u bytes%s\n", pageIndex, took, backdropSize[slot],
+                      fits ? "" : ", too big, drawn on the switch");
+#endif
+        return; // one page per pass, the loop has other work
+    }
+}
 
-    if (millis() - flashTime >= flashRate)
+// -----------------------------------------------
+
+// A quality level from the governor.  The attitude page reads the level as it draws: fewer
+// pitch ladder labels, then no symbol outlines.  The cached AOA widgets do not depend on it.
+
+void setQuality(uint8_t level)
+{
+    Serial.printf("Display quality level %u: render avg %u us, budget %u us\n", level, qualityGovernor.avgUs,
+                  qualityGovernor.budgetUs);
+}
+
+// -----------------------------------------------
+
+#if defined(FRAMESTATSDEBUG)
+// Render time of every page: redrawn in full, started from the static layer, and started from
+// the static layer with the draws recorded into the display list.  Each frame is
+// flushed with fence() so the time includes filling the display list.  The full redraw also
+// counts the sine table lookups (FastTrig.h) a frame takes.
+
+uint32_t benchmarkPage(bool useStaticLayer)
+{
+    const int benchFrames = 20;
+
+    staticLayerPage = -1;
+    renderPage(useStaticLayer); // draws the static layer
+    frameSprite.fence();
+
+    uint32_t start = micros();
+    for (int i = 0; i < benchFrames; i++)
     {
-        flashFlag = !flashFlag;
-        flashTime = millis();
+        renderPage(useStaticLayer);
+        frameSprite.fence();
     }
+    return (micros() - start) / benchFrames;
+}
 
-    gdraw.pushSprite(0, 0);
-    gdraw.deleteSprite();
-} // end loop()
+void benchmarkPages()
+{
+    int16_t savedType = displayType;
+    bool banded = frameSprite.banded();
+
+    for (displayType = 0; displayType < displayPageCount; displayType++)
+    {
+        frameSprite.setBanded(false);
+        trigLookups()  = 0;
+        trigCounting() = true;
+        uint32_t fullUs = benchmarkPage(false);
+        trigCounting() = false;
+        uint32_t trigPerFrame = trigLookups() / 21; // the static layer's render and 20 frames
+        uint32_t layerUs = benchmarkPage(true);
+
+        frameSprite.setBanded(banded);
+        uint32_t bandedUs = banded ? benchmarkPage(true) : 0;
+
+        Serial.printf("Page %d render: %u us full redraw, %u us from static layer, %u us recorded, "
+                      "%u bit frame + layer %u bytes, %u draws outside the palette, %u sine table lookups\n",
+                      displayType, fullUs, layerUs, bandedUs, FRAME_DEPTH,
+                      frameSprite.hasLayer() ? 2 * FRAME_BYTES : FRAME_BYTES, frameSprite.paletteMisses, trigPerFrame);
+        frameSprite.paletteMisses = 0;
+    }
+
+    // the G history plot as a strip chart, against plotting every sample
+    for (int i = 0; i < 300; i++)
+        gChart.add(gHistory[(gHistoryIndex + i) % 300], gPlotColour(gHistory[(gHistoryIndex + i) % 300]));
+    frameSprite.setBanded(false);
+    uint32_t start = micros();
+    for (int i = 0; i < 20; i++)
+        displayGloadDots();
+    uint32_t dotsUs = (micros() - start) / 20;
+    start = micros();
+    for (int i = 0; i < 20; i++)
+        gChart.draw(gdraw);
+    uint32_t chartUs = (micros() - start) / 20;
+    frameSprite.setBanded(banded);
+    Serial.printf("G history plot: %u us per frame as dots, %u us as a strip chart of %u bytes\n", dotsUs, chartUs,
+                  gChart.bytes());
+
+    // the symbols from their runs, against drawing their shapes
+    frameSprite.setBanded(false);
+    for (int16_t k = 0; k < symbolCount; k++)
+    {
+        Symbol &s = *symbols[k];
+        int16_t x = &s == &noDataSymbol ? 0 : WIDTH / 2; // the no data screen is anchored at its corner
+        int16_t y = &s == &noDataSymbol ? 0 : HEIGHT / 2;
+        start = micros();
+        for (int i = 0; i < 20; i++)
+            s.drawFn()(gdraw, x, y);
+        uint32_t shapeUs = (micros() - start) / 20;
+        start = micros();
+        for (int i = 0; i < 20; i++)
+            s.draw(gdraw, x, y);
+        uint32_t runsUs = (micros() - start) / 20;
+        s.clearStats();
+        Serial.printf("Symbol %s: %u us drawn, %u us from %u runs\n", s.name, shapeUs, runsUs, s.runs());
+    }
+    frameSprite.setBanded(banded);
+
+    displayType = savedType;
+    staticLayerPage = -1;
+}
+#endif
+
+// -----------------------------------------------
+
+void aoaPageLayout(bool numeric)
+{
+    wgtWidth = 102;
+    wgtHeight = 192;
+    wgtX0 = (WIDTH - wgtWidth) / 2;
+    wgtY0 = 0;
+    numericDisplay = numeric;
+}
+
+void aoaPageStatic()
+{
+    aoaPageLayout(true);
+    displayAOAStatic();
+}
+
+void aoaPage()
+{
+    aoaPageLayout(true);
+    displayAOA();
+}
+
+void narrowAOAPageStatic()
+{
+    aoaPageLayout(false);
+    displayAOAStatic();
+}
+
+void narrowAOAPage()
+{
+    aoaPageLayout(false);
+    displayAOA();
+}
+
+// -----------------------------------------------
+
+// VSI / g onset ladder on the right edge, with its zero line
+
+void drawLadder(int16_t first, int16_t last, int16_t step, uint16_t color)
+{
+    for (int i = first; i < last; i = i + step)
+    {
+        gdraw.drawLine(313, i, 319, i, color);
+    }
+
+    // zero line
+    gdraw.drawLine(306, 118, 312, 118, color);
+    gdraw.drawLine(306, 119, 312, 119, color);
+    gdraw.drawLine(306, 120, 312, 120, color);
+}
+
+// -----------------------------------------------
+
+// Constant parts of the AOA pages
+
+void displayAOAStatic()
+{
+    drawAOAFrame(wgtX0, wgtY0, wgtWidth, wgtHeight);
+
+#if defined(FRAME_4BPP)
+    uint16_t slots[AOA_SHAPES];
+    for (uint8_t shape = 0; shape < AOA_SHAPES; shape++)
+        slots[shape] = FRAME_SLOT_COLOR(AOA_SLOT_FIRST + shape);
+    drawAOAShapes(wgtX0, wgtY0, wgtWidth, wgtHeight, slots);
+#endif
+
+    if (numericDisplay)
+    {
+        gdraw.setFreeFont(FSS18);
+
+        gdraw.setCursor(5, 90);
+        gdraw.setTextColor(TFT_GREEN);
+        gdraw.print("IAS ");
+        gdraw.setCursor(278, 90);
+        gdraw.setTextColor(TFT_GREEN);
+        gdraw.print("G");
+    }
+
+    // vsi ladder, every 15 pixels
+    drawLadder(15, 226, 15, TFT_LIGHTGREY);
+}
 
 // -----------------------------------------------
 
 // Update AOA display
 
-void displayAOA()
+void setAOAThresholds()
 {
     // Build Setpoint array
     // --------------------
@@ -698,8 +1230,18 @@ void displayAOA()
     AOAThresholds[5] = OnSpeedSlowAOA + 0.1f;
     AOAThresholds[6] = OnSpeedStallWarnAOA - 0.1f;
     AOAThresholds[7] = OnSpeedStallWarnAOA;
+}
 
-    drawAOA(wgtX0, wgtY0, wgtWidth, wgtHeight, SmoothedAOA, flashFlag, AOAThresholds);
+void displayAOA()
+{
+    setAOAThresholds();
+
+    // AOA indexer: shape colours and pointer position
+    if (aoaWidget.begin(frameSprite, aoaIndexerState()))
+    {
+        drawAOA(wgtX0, wgtY0, wgtWidth, wgtHeight, renderFrame.AOA, flashFlag, AOAThresholds);
+        aoaWidget.end(frameSprite);
+    }
 
 // Draw the percent lift display
 // -----------------------------
@@ -707,121 +1249,127 @@ void displayAOA()
 #define PERCENT_Y_POS 27 // Top of chevron
                          //  #define PERCENT_Y_POS   182     // Bottom of chevron
 
-    gdraw.setFreeFont(FSSB18);
+    if (liftWidget.begin(frameSprite, WidgetKey().add(displayPercentLift).value))
+    {
+        gdraw.setFreeFont(FSSB18);
 
-    // Black background boarder
-    gdraw.setTextColor(TFT_BLACK);
-    for (int xoffset = -3; xoffset <= 3; xoffset += 3)
-        for (int yoffset = -3; yoffset <= 3; yoffset += 3)
-        {
-            if (displayPercentLift < 100)
-                gdraw.setCursor(PERCENT_X_POS + xoffset, PERCENT_Y_POS + yoffset);
-            else
-                gdraw.setCursor(PERCENT_X_POS - 7 + xoffset, PERCENT_Y_POS + yoffset);
-            gdraw.printf("%02d", displayPercentLift);
-        }
+        // Black background boarder
+        gdraw.setTextColor(TFT_BLACK);
+        for (int xoffset = -3; xoffset <= 3; xoffset += 3)
+            for (int yoffset = -3; yoffset <= 3; yoffset += 3)
+            {
+                if (displayPercentLift < 100)
+                    gdraw.setCursor(PERCENT_X_POS + xoffset, PERCENT_Y_POS + yoffset);
+                else
+                    gdraw.setCursor(PERCENT_X_POS - 7 + xoffset, PERCENT_Y_POS + yoffset);
+                gdraw.printf("%02d", displayPercentLift);
+            }
 
-    // White text
-    gdraw.setTextColor(TFT_WHITE);
-    if (displayPercentLift < 100)
-        gdraw.setCursor(PERCENT_X_POS, PERCENT_Y_POS);
-    else
-        gdraw.setCursor(PERCENT_X_POS - 7, PERCENT_Y_POS);
-    gdraw.printf("%02d", displayPercentLift);
+        // White text
+        gdraw.setTextColor(TFT_WHITE);
+        if (displayPercentLift < 100)
+            gdraw.setCursor(PERCENT_X_POS, PERCENT_Y_POS);
+        else
+            gdraw.setCursor(PERCENT_X_POS - 7, PERCENT_Y_POS);
+        gdraw.printf("%02d", displayPercentLift);
+        liftWidget.end(frameSprite);
+    }
 
     if (numericDisplay)
     {
         // Update airspeed numeric display
         // -------------------------------
-        gdraw.setFreeFont(FSS18);
-
-        gdraw.setCursor(5, 90);
-        gdraw.setTextColor(TFT_GREEN);
-        gdraw.print("IAS ");
-        gdraw.setCursor(278, 90);
-        gdraw.setTextColor(TFT_GREEN);
-        gdraw.print("G");
-
-        gdraw.setFreeFont(FSSB18);
-        // update IAS numeric display
-        gdraw.setTextColor(TFT_WHITE);
-        gdraw.setCursor(7, 130);
-        gdraw.print(int(displayIAS));
+        if (iasWidget.begin(frameSprite, WidgetKey().add(int(displayIAS)).value))
+        {
+            gdraw.setFreeFont(FSSB18);
+            // update IAS numeric display
+            gdraw.setTextColor(TFT_WHITE);
+            gdraw.setCursor(7, 130);
+            gdraw.print(int(displayIAS));
+            iasWidget.end(frameSprite);
+        }
 
         // Update G-force numeric display
         // ------------------------------
-        gdraw.setFreeFont(FSSB18);
-        gdraw.setTextColor(TFT_WHITE);
         // gdraw.setCursor(235, 130);
         // gdraw.printf ("%+1.1f", displayVerticalG);
-        char GStr[5];
-        sprintf(GStr, "%+1.1f", displayVerticalG);
-        gdraw.setTextDatum(MR_DATUM);
-        gdraw.drawString(GStr, 305, 118);
+        Readouts text;
+        formatReadouts(text);
+        if (gWidget.begin(frameSprite, WidgetKey().addText(text.g).value))
+        {
+            gdraw.setFreeFont(FSSB18);
+            gdraw.setTextColor(TFT_WHITE);
+            gdraw.setTextDatum(MR_DATUM);
+            gdraw.drawString(text.g, 305, 118);
+            gWidget.end(frameSprite);
+        }
 
         // Update flaps display
         // --------------------
-        gdraw.fillCircle(23, 204, 16, TFT_DARKGREY);
-        // top, bottom, right
-        int cX = 23;
-        int cY = 204;
-        int Radius = 16;
-        int triangleTopX = int(cX + sin(FlapPos * PI / 180) * Radius);
-        int triangleTopY = int(cY - cos(FlapPos * PI / 180) * Radius);
-        int triangleBottomX = int(cX - sin(FlapPos * PI / 180) * Radius);
-        int triangleBottomY = int(cY + cos(FlapPos * PI / 180) * Radius);
-        int triangleRightX = int(cX + cos(FlapPos * PI / 180) * (Radius + 33));
-        int triangleRightY = int(cY + sin(FlapPos * PI / 180) * (Radius + 33));
-        gdraw.fillTriangle(triangleTopX, triangleTopY, triangleBottomX, triangleBottomY, triangleRightX, triangleRightY, TFT_DARKGREY);
-        gdraw.drawPixel(triangleRightX, triangleRightY, TFT_BLACK); // blunt the flap tip 1 pixel
-        // gdraw.fillCircle (23, 204, 14, TFT_BLACK);
-
-        // show flap stops
-        gdraw.drawPixel(72, 204, TFT_WHITE);
-        gdraw.drawPixel(71, 212, TFT_WHITE);
-        gdraw.drawPixel(69, 220, TFT_WHITE);
-        gdraw.drawPixel(65, 228, TFT_WHITE);
-        gdraw.drawPixel(60, 235, TFT_WHITE);
-
-        // show numeric flap angle
-        gdraw.setFreeFont(FSS12);
-        gdraw.setTextColor(TFT_WHITE);
-        gdraw.setTextDatum(MC_DATUM);
-        char FlapsChar[2];
-        sprintf(FlapsChar, "%i", FlapPos);
-        gdraw.drawString(FlapsChar, cX, cY);
+        if (flapWidget.begin(frameSprite, WidgetKey().add(FlapPos).value))
+        {
+            gdraw.fillCircle(23, 204, 16, TFT_DARKGREY);
+            // top, bottom, right
+            int cX = 23;
+            int cY = 204;
+            int Radius = 16;
+            float sinFlap, cosFlap;
+            fastSinCos(FlapPos * PI / 180, sinFlap, cosFlap);
+            int triangleTopX = int(cX + sinFlap * Radius);
+            int triangleTopY = int(cY - cosFlap * Radius);
+            int triangleBottomX = int(cX - sinFlap * Radius);
+            int triangleBottomY = int(cY + cosFlap * Radius);
+            int triangleRightX = int(cX + cosFlap * (Radius + 33));
+            int triangleRightY = int(cY + sinFlap * (Radius + 33));
+            gdraw.fillTriangle(triangleTopX, triangleTopY, triangleBottomX, triangleBottomY, triangleRightX, triangleRightY, TFT_DARKGREY);
+            gdraw.drawPixel(triangleRightX, triangleRightY, TFT_BLACK); // blunt the flap tip 1 pixel
+            // gdraw.fillCircle (23, 204, 14, TFT_BLACK);
+
+            // show flap stops
+            gdraw.drawPixel(72, 204, TFT_WHITE);
+            gdraw.drawPixel(71, 212, TFT_WHITE);
+            gdraw.drawPixel(69, 220, TFT_WHITE);
+            gdraw.drawPixel(65, 228, TFT_WHITE);
+            gdraw.drawPixel(60, 235, TFT_WHITE);
+
+            // show numeric flap angle
+            gdraw.setFreeFont(FSS12);
+            gdraw.setTextColor(TFT_WHITE);
+            gdraw.setTextDatum(MC_DATUM);
+            char FlapsChar[2];
+            sprintf(FlapsChar, "%i", FlapPos);
+            gdraw.drawString(FlapsChar, cX, cY);
+            flapWidget.end(frameSprite);
+        }
     } // end if numeric display
 
     // Update ball display
     // -------------------
-    drawSlip(80, 204, 160, 34, Slip, flashFlag, AOAThresholds);
+    int16_t slip = lroundf(renderFrame.Slip);
+    if (slipWidget.begin(frameSprite, slipState(flashFlag)))
+    {
+        drawSlip(80, 204, 160, 34, slip, flashFlag, AOAThresholds);
+        slipWidget.end(frameSprite);
+    }
 
     // Update gOnset rates
     // -------------------
     // draw gOnset line
-    if (gOnsetRate != 0.0)
+    int16_t gOnset = gOnsetBar();
+    if (gOnset != 0 && gOnsetWidget.begin(frameSprite, WidgetKey().add(gOnset).value))
     {
-        int gOnsetHeight = abs(int(gOnsetRate * 120 / 2));
-        gOnsetHeight = constrain(gOnsetHeight, 0, 120);
         int gOnsetTop;
-        if (gOnsetRate > 0)
-            gOnsetTop = 119 - gOnsetHeight;
+        if (gOnset > 0)
+            gOnsetTop = 119 - gOnset;
         else
             gOnsetTop = 119;
-        gdraw.fillRect(313, gOnsetTop, 7, gOnsetHeight, TFT_YELLOW);
-    }
+        gdraw.fillRect(313, gOnsetTop, 7, abs(gOnset), TFT_YELLOW);
 
-    // vsi ladder, every 20 pixels
-    for (int i = 15; i < 226; i = i + 15)
-    {
-        gdraw.drawLine(313, i, 319, i, TFT_LIGHTGREY);
+        // ladder stays on top of the bar
+        drawLadder(15, 226, 15, TFT_LIGHTGREY);
+        gOnsetWidget.end(frameSprite);
     }
 
-    // zero line
-    gdraw.drawLine(306, 118, 312, 118, TFT_LIGHTGREY);
-    gdraw.drawLine(306, 119, 312, 119, TFT_LIGHTGREY);
-    gdraw.drawLine(306, 120, 312, 120, TFT_LIGHTGREY);
-
 #if defined(DATAMARK_DISPLAY)
     // Draw Data Mark value
     // --------------------
@@ -834,43 +1382,197 @@ void displayAOA()
 
 // -----------------------------------------------
 
+// What the pages show at display resolution, for pageState(): positions in pixels, readouts
+// as the strings drawn, and colours, which carry the flash phase where it shows.  The pages
+// draw from the same helpers, so a change that shows changes the state.
+
+uint32_t aoaState()
+{
+    setAOAThresholds();
+    WidgetKey key;
+    key.add(aoaIndexerState()).add(displayPercentLift);
+
+    if (numericDisplay)
+    {
+        Readouts text;
+        formatReadouts(text);
+        key.add(int(displayIAS)).addText(text.g).add(FlapPos);
+    }
+
+    key.add(slipState(flashFlag)).add(gOnsetBar());
+#if defined(DATAMARK_DISPLAY)
+    key.add(DataMark);
+#endif
+    return key.value;
+}
+
+uint32_t aoaPageState()
+{
+    aoaPageLayout(true);
+    return aoaState();
+}
+
+uint32_t narrowAOAPageState()
+{
+    aoaPageLayout(false);
+    return aoaState();
+}
+
+uint32_t attitudePageState()
+{
+    Readouts text;
+    formatReadouts(text);
+    WidgetKey key;
+    key.add(lroundf(renderFrame.Roll * 10)).add(lroundf(renderFrame.Pitch * HEIGHT / 80));
+    key.add(flightPathY(renderFrame.FlightPath, renderFrame.Pitch));
+    key.addText(text.pitch).add(int(displayIAS)).addText(text.g).addText(text.palt);
+    key.add(displayPercentLift).add(slipState(false)).add(vsiBar());
+    return key.value;
+}
+
+uint32_t decelPageState()
+{
+    Readouts text;
+    formatReadouts(text);
+    WidgetKey key;
+    key.add(decelPointerY()).add(vsiBar()).add(slipState(false)).add(int(displayIAS));
+    return key.addText(text.decel).addText(text.ps).value;
+}
+
+uint32_t gloadPageState()
+{
+    return WidgetKey().add(gHistoryIndex).value;
+}
+
+// slip ball position and colour
+uint32_t slipState(boolean flash)
+{
+    int16_t slip = lroundf(renderFrame.Slip);
+    return WidgetKey().add(slip).add(slipColour(slip, flash, AOAThresholds)).value;
+}
+
+// AOA indexer shape colours and pointer position
+uint32_t aoaIndexerState()
+{
+    uint16_t colours[AOA_SHAPES];
+    aoaColours(renderFrame.AOA, flashFlag, AOAThresholds, colours);
+    WidgetKey key;
+    for (uint8_t shape = 0; shape < AOA_SHAPES; shape++)
+        key.add(colours[shape]);
+    return key.add(mapAOA2Display(renderFrame.AOA, AOAThresholds)).value;
+}
+
+// iVSI bar height in pixels, negative for a descent
+int16_t vsiBar()
+{
+    if (iVSI == 0.0)
+        return 0;
+    int vsiHeight = abs(int(iVSI * 120 / 600));
+    vsiHeight = constrain(vsiHeight, 0, 120);
+    return iVSI > 0 ? vsiHeight : -vsiHeight;
+}
+
+// G onset bar height in pixels, negative for an unload
+int16_t gOnsetBar()
+{
+    if (gOnsetRate == 0.0)
+        return 0;
+    int gOnsetHeight = abs(int(gOnsetRate * 120 / 2));
+    gOnsetHeight = constrain(gOnsetHeight, 0, 120);
+    return gOnsetRate > 0 ? gOnsetHeight : -gOnsetHeight;
+}
+
+// flight path marker centre, 40 degrees of pitch per half screen height
+int16_t flightPathY(float flightPathAngle, float pitch)
+{
+    int fpY = 120 - (flightPathAngle - pitch) * 120 / 40;
+    return constrain(fpY, 0, 239);
+}
+
+// the numeric readouts as the pages print them
+void formatReadouts(Readouts &text)
+{
+    sprintf(text.pitch, "%1.1f", displayPitch);
+    sprintf(text.g, "%+1.1f", displayVerticalG);
+    sprintf(text.palt, "%5.0f", displayPalt);
+    sprintf(text.decel, "%+1.1f", displayDecelRate);
+    sprintf(text.ps, "%+d", displayPs / 10 * 10);
+}
+
+// -----------------------------------------------
+
 //
-// Draw AOA indicator
+// Draw AOA indicator bounding box, part of the static layer
 //
-void drawAOA(uint16_t X0, uint16_t Y0, uint16_t W, uint16_t H, float AOA, boolean flashFlag, float Array[])
+void drawAOAFrame(uint16_t X0, uint16_t Y0, uint16_t W, uint16_t H)
+{
+    gdraw.drawRoundRect(X0, Y0, W, H, 5, TFT_DARKGREY);                 // Gauge bounding box
+    gdraw.drawRoundRect(X0 + 1, Y0 + 1, W - 2, H - 2, 5, TFT_DARKGREY); // Gauge bounding box
+}
+
+// -----------------------------------------------
+
+//
+// AOA indicator colours for the current state, indexed by AOAShape
+//
+void aoaColours(float AOA, boolean flashFlag, float Array[], uint16_t colours[])
+{
+    // Top chevron changes color midway between "slow" (4) and "stall warning" (7)
+    float chevMid = Array[4] + (Array[7] - Array[4]) / 2.0;
+    if (AOA > Array[4] && AOA <= chevMid)
+        colours[AOA_TOP_CHEVRON] = TFT_YELLOW;
+    else if (AOA > chevMid && AOA <= Array[7])
+        colours[AOA_TOP_CHEVRON] = TFT_RED;
+    else if (AOA > Array[7] && !flashFlag)
+        colours[AOA_TOP_CHEVRON] = TFT_RED;
+    else
+        colours[AOA_TOP_CHEVRON] = TFT_DARKGREY;
+
+    if (AOA >= Array[1] && AOA < Array[4])
+        colours[AOA_BOTTOM_CHEVRON] = TFT_LIGHT_BLUE; // was TFT_ORANGE
+    else
+        colours[AOA_BOTTOM_CHEVRON] = TFT_DARKGREY;
+
+    float OnspeedRange = Array[4] - Array[3];
+
+    if (AOA >= Array[3] && AOA <= (Array[4] - OnspeedRange * 0.25))
+        colours[AOA_BOTTOM_ARC] = TFT_GREEN;
+    else
+        colours[AOA_BOTTOM_ARC] = TFT_DARKGREY;
+
+    if (AOA >= (Array[3] + OnspeedRange * 0.25) && AOA <= Array[4])
+        colours[AOA_TOP_ARC] = TFT_GREEN;
+    else
+        colours[AOA_TOP_ARC] = TFT_DARKGREY;
+
+    if (AOA >= (Array[3] + OnspeedRange * 0.25) && AOA <= (Array[4] - OnspeedRange * 0.25))
+        colours[AOA_CENTER_DOT] = TFT_GREEN;
+    else
+        colours[AOA_CENTER_DOT] = TFT_DARKGREY;
+}
+
+// -----------------------------------------------
+
+//
+// Draw AOA indicator chevrons, onspeed arcs and center dot
+//
+void drawAOAShapes(uint16_t X0, uint16_t Y0, uint16_t W, uint16_t H, const uint16_t colours[])
 {
     float Theta;
     float cosTheta;
     float sinTheta;
-    uint16_t Colour;
 
     X0 = X0 + W / 2;
     Y0 = Y0 + H / 2; // Adjust datum to center of widget
 
-    gdraw.drawRoundRect(X0 - W / 2, Y0 - H / 2, W, H, 5, TFT_DARKGREY);                 // Gauge bounding box
-    gdraw.drawRoundRect(X0 - W / 2 + 1, Y0 - H / 2 + 1, W - 2, H - 2, 5, TFT_DARKGREY); // Gauge bounding box
-
     int16_t Px0 = -W / 12, Py0 = -H / 4;
     int16_t Px1 = +W / 12, Py1 = H / 4;
 
     /*
      Top chevron
     */
-
-    // Chevron changes color midway between "slow" (4) and "stall warning" (7)
-    float chevMid = Array[4] + (Array[7] - Array[4]) / 2.0;
-    if (AOA > Array[4] && AOA <= chevMid)
-        Colour = TFT_YELLOW;
-    else if (AOA > chevMid && AOA <= Array[7])
-        Colour = TFT_RED;
-    else if (AOA > Array[7] && !flashFlag)
-        Colour = TFT_RED;
-    else
-        Colour = TFT_DARKGREY;
-
     Theta = PI / 8;
-    cosTheta = cos(Theta);
-    sinTheta = sin(Theta);
+    fastSinCos(Theta, sinTheta, cosTheta);
 
     int16_t XA0 = (Px0 * cosTheta - Py0 * sinTheta) + X0 + W / 4;
     int16_t YA0 = (Px0 * sinTheta + Py0 * cosTheta) + Y0 - H / 4;
@@ -884,12 +1586,11 @@ void drawAOA(uint16_t X0, uint16_t Y0, uint16_t W, uint16_t H, float AOA, boolea
     int16_t XA3 = (Px0 * cosTheta - Py1 * sinTheta) + X0 + W / 4;
     int16_t YA3 = (Px0 * sinTheta + Py1 * cosTheta) + Y0 - H / 4;
 
-    gdraw.fillTriangle(XA0, YA0, XA1, YA1, XA3, YA3, Colour);
-    gdraw.fillTriangle(XA1, YA1, XA2, YA2, XA3, YA3, Colour);
+    gdraw.fillTriangle(XA0, YA0, XA1, YA1, XA3, YA3, colours[AOA_TOP_CHEVRON]);
+    gdraw.fillTriangle(XA1, YA1, XA2, YA2, XA3, YA3, colours[AOA_TOP_CHEVRON]);
 
     Theta = -PI / 8;
-    cosTheta = cos(Theta);
-    sinTheta = sin(Theta);
+    fastSinCos(Theta, sinTheta, cosTheta);
 
     XA0 = (Px0 * cosTheta - Py0 * sinTheta) + X0 - W / 4;
     YA0 = (Px0 * sinTheta + Py0 * cosTheta) + Y0 - H / 4;
@@ -903,20 +1604,14 @@ void drawAOA(uint16_t X0, uint16_t Y0, uint16_t W, uint16_t H, float AOA, boolea
     XA3 = (Px0 * cosTheta - Py1 * sinTheta) + X0 - W / 4;
     YA3 = (Px0 * sinTheta + Py1 * cosTheta) + Y0 - H / 4;
 
-    gdraw.fillTriangle(XA0, YA0, XA1, YA1, XA3, YA3, Colour);
-    gdraw.fillTriangle(XA1, YA1, XA2, YA2, XA3, YA3, Colour);
+    gdraw.fillTriangle(XA0, YA0, XA1, YA1, XA3, YA3, colours[AOA_TOP_CHEVRON]);
+    gdraw.fillTriangle(XA1, YA1, XA2, YA2, XA3, YA3, colours[AOA_TOP_CHEVRON]);
 
     /*
      Bottom chevron
     */
-    if (AOA >= Array[1] && AOA < Array[4])
-        Colour = TFT_LIGHT_BLUE; // was TFT_ORANGE
-    else
-        Colour = TFT_DARKGREY;
-
     Theta = PI / 8;
-    cosTheta = cos(Theta);
-    sinTheta = sin(Theta);
+    fastSinCos(Theta, sinTheta, cosTheta);
 
     XA0 = (Px0 * cosTheta - Py0 * sinTheta) + X0 - W / 4;
     YA0 = (Px0 * sinTheta + Py0 * cosTheta) + Y0 + H / 4;
@@ -930,12 +1625,11 @@ void drawAOA(uint16_t X0, uint16_t Y0, uint16_t W, uint16_t H, float AOA, boolea
     XA3 = (Px0 * cosTheta - Py1 * sinTheta) + X0 - W / 4;
     YA3 = (Px0 * sinTheta + Py1 * cosTheta) + Y0 + H / 4;
 
-    gdraw.fillTriangle(XA0, YA0, XA1, YA1, XA3, YA3, Colour);
-    gdraw.fillTriangle(XA1, YA1, XA2, YA2, XA3, YA3, Colour);
+    gdraw.fillTriangle(XA0, YA0, XA1, YA1, XA3, YA3, colours[AOA_BOTTOM_CHEVRON]);
+    gdraw.fillTriangle(XA1, YA1, XA2, YA2, XA3, YA3, colours[AOA_BOTTOM_CHEVRON]);
 
     Theta = -PI / 8;
-    cosTheta = cos(Theta);
-    sinTheta = sin(Theta);
+    fastSinCos(Theta, sinTheta, cosTheta);
 
     XA0 = (Px0 * cosTheta - Py0 * sinTheta) + X0 + W / 4;
     YA0 = (Px0 * sinTheta + Py0 * cosTheta) + Y0 + H / 4;
@@ -949,8 +1643,8 @@ void drawAOA(uint16_t X0, uint16_t Y0, uint16_t W, uint16_t H, float AOA, boolea
     XA3 = (Px0 * cosTheta - Py1 * sinTheta) + X0 + W / 4;
     YA3 = (Px0 * sinTheta + Py1 * cosTheta) + Y0 + H / 4;
 
-    gdraw.fillTriangle(XA0, YA0, XA1, YA1, XA3, YA3, Colour);
-    gdraw.fillTriangle(XA1, YA1, XA2, YA2, XA3, YA3, Colour);
+    gdraw.fillTriangle(XA0, YA0, XA1, YA1, XA3, YA3, colours[AOA_BOTTOM_CHEVRON]);
+    gdraw.fillTriangle(XA1, YA1, XA2, YA2, XA3, YA3, colours[AOA_BOTTOM_CHEVRON]);
 
     /*
      Draw black surround for inner circles
@@ -958,33 +1652,42 @@ void drawAOA(uint16_t X0, uint16_t Y0, uint16_t W, uint16_t H, float AOA, boolea
     uint16_t bullsEye = H * (65 - 55 - 2) / 200;
     gdraw.fillCircle(X0, Y0, bullsEye + H / 12, TFT_BLACK);
 
-    float OnspeedRange = Array[4] - Array[3];
     int16_t ArcRadius = bullsEye + H / 16;
     uint16_t LineWidth = 8;
 
     // Bottom arc
-    if (AOA >= Array[3] && AOA <= (Array[4] - OnspeedRange * 0.25))
-        Colour = TFT_GREEN;
-    else
-        Colour = TFT_DARKGREY;
-    myGauges.drawArc(X0, Y0, ArcRadius, 0.0, PI, Colour, LineWidth);
+    myGauges.drawArc(X0, Y0, ArcRadius, 0.0, PI, colours[AOA_BOTTOM_ARC], LineWidth);
 
     // Top arc
-    if (AOA >= (Array[3] + OnspeedRange * 0.25) && AOA <= Array[4])
-        Colour = TFT_GREEN;
-    else
-        Colour = TFT_DARKGREY;
-    myGauges.drawArc(X0, Y0, ArcRadius, PI, PI, Colour, LineWidth);
+    myGauges.drawArc(X0, Y0, ArcRadius, PI, PI, colours[AOA_TOP_ARC], LineWidth);
 
     // Black segments between arcs
     gdraw.fillRect(X0 - W / 3, Y0 - H / 48, 2 * W / 3, H / 24, TFT_BLACK);
 
     // Center dot
-    if (AOA >= (Array[3] + OnspeedRange * 0.25) && AOA <= (Array[4] - OnspeedRange * 0.25))
-        Colour = TFT_GREEN;
-    else
-        Colour = TFT_DARKGREY;
-    gdraw.fillCircle(X0, Y0, bullsEye + 2, Colour);
+    gdraw.fillCircle(X0, Y0, bullsEye + 2, colours[AOA_CENTER_DOT]);
+}
+
+// -----------------------------------------------
+
+//
+// Draw AOA indicator
+//
+void drawAOA(uint16_t X0, uint16_t Y0, uint16_t W, uint16_t H, float AOA, boolean flashFlag, float Array[])
+{
+    uint16_t colours[AOA_SHAPES];
+    aoaColours(AOA, flashFlag, Array, colours);
+
+#if defined(FRAME_4BPP)
+    // the shapes are drawn once in their palette slots (displayAOAStatic), only recolour them
+    for (uint8_t shape = 0; shape < AOA_SHAPES; shape++)
+        frameSprite.setSlotColor(AOA_SLOT_FIRST + shape, colours[shape]);
+#else
+    drawAOAShapes(X0, Y0, W, H, colours);
+#endif
+
+    X0 = X0 + W / 2;
+    Y0 = Y0 + H / 2; // Adjust datum to center of widget
 
     /*
     Index pointer
@@ -1002,6 +1705,18 @@ void drawAOA(uint16_t X0, uint16_t Y0, uint16_t W, uint16_t H, float AOA, boolea
     gdraw.fillCircle(X0 + W / 2 - 1, (HEIGHT - 39 * HEIGHT / 100), H / 32, TFT_WHITE);
 } // end drawAOA()
 
+// -----------------------------------------------
+
+//
+// Slip ball colour, flashing in a stall with a large slip
+//
+uint16_t slipColour(int16_t Slip, boolean flashFlag, float Array[])
+{
+    if ((abs(Slip) >= 30) && AOA >= Array[7])
+        return flashFlag ? TFT_BLACK : TFT_RED;
+    return TFT_GREEN;
+}
+
 // -----------------------------------------------
 /*
    Draw slip indicator
@@ -1016,15 +1731,12 @@ void drawSlip(uint16_t X0, uint16_t Y0, uint16_t W, uint16_t H, int16_t Slip, bo
      Add ball graphic
     */
 
-    uint16_t Colour = TFT_GREEN;
-    if (flashFlag && (abs(Slip) >= 30) && AOA >= Array[7])
-    {
-        Colour = TFT_BLACK;
-    }
-    if (!flashFlag && (abs(Slip) >= 30) && AOA >= Array[7])
-    {
-        Colour = TFT_RED;
-    }
+    uint16_t Colour = slipColour(Slip, flashFlag, Array);
+#if defined(FRAME_4BPP)
+    // the flash only recolours the ball's palette slot, on the pages that have one
+    if (frameSprite.setSlotColor(SLIP_BALL_SLOT, Colour))
+        Colour = FRAME_SLOT_COLOR(SLIP_BALL_SLOT);
+#endif
 
     gdraw.fillCircle(CenterX + Slip * (W - H - 1) / 99 / 2, CenterY, H / 2 - 1, Colour);
 
@@ -1039,9 +1751,95 @@ void drawSlip(uint16_t X0, uint16_t Y0, uint16_t W, uint16_t H, int16_t Slip, bo
 
 // -----------------------------------------------
 
+void displayAttitude()
+{
+    // display Attitude Indicator
+    AiGraph(px0, py0, arcSize, arcWidth, maxDisplay, minDisplay, startAngle, arcAngle, clockWise,
+            gradMarks, renderFrame.Pitch, renderFrame.Roll, 360, renderFrame.FlightPath);
+
+    // update numeric displays
+    // Update airspeed numeric display
+    // print labels
+    gdraw.setFreeFont(FSS12);
+
+    gdraw.setCursor(5, 60);
+    gdraw.setTextColor(TFT_LIGHTGREY);
+    gdraw.print("IAS");
+
+    gdraw.setCursor(5, 230);
+    gdraw.setTextColor(TFT_LIGHTGREY);
+    gdraw.print("G");
+
+    gdraw.setCursor(243, 60);
+    gdraw.setTextColor(TFT_LIGHTGREY);
+    gdraw.print("P-ALT");
+
+    gdraw.setCursor(260, 230);
+    gdraw.setTextColor(TFT_LIGHTGREY);
+    gdraw.print("AOA");
+
+    // update numeric pitch display
+    // same font as labels
+    // dark background for pitch readability
+    gdraw.fillRoundRect(55, 129, 56, 21, 3, TFT_LIGHTGREY);
+
+    gdraw.setTextColor(TFT_WHITE);
+    Readouts text;
+    formatReadouts(text);
+    gdraw.setTextDatum(MR_DATUM);
+    gdraw.drawString(text.pitch, 100, 138);
+    // draw degree symbol
+    gdraw.drawCircle(106, 132, 0.50f * 5, TFT_WHITE);
+
+    gdraw.setFreeFont(FSSB18);
+    gdraw.setTextColor(TFT_BLACK);
+    gdraw.setCursor(5, 30);
+    gdraw.print(int(displayIAS));
+
+    // Update G-force numeric display
+    // gdraw.setFreeFont(FSSB18);
+    gdraw.setTextColor(TFT_WHITE);
+    gdraw.setCursor(5, 200);
+    gdraw.print(text.g);
+
+    // Update pressure altitude numeric display
+    // gdraw.setFreeFont(FSSB18);
+    gdraw.setTextColor(TFT_BLACK);
+    gdraw.setTextDatum(MR_DATUM);
+    gdraw.drawString(text.palt, 309, 18);
+
+    // Update AOA numeric display
+    // gdraw.setFreeFont(FSSB18);
+    gdraw.setTextColor(TFT_WHITE);
+    gdraw.setCursor(269, 200);
+    gdraw.printf("%02d", displayPercentLift);
+
+    // Update ball display on attitude page
+    // Increase sensitivity of slip indicator
+    drawSlip(80, 204, 160, 20, lroundf(renderFrame.Slip), false, AOAThresholds);
+
+    // iVSI
+    // draw iVSI line
+    int16_t vsi = vsiBar();
+    if (vsi != 0)
+    {
+        int vsiTop;
+        if (vsi > 0)
+            vsiTop = 119 - vsi;
+        else
+            vsiTop = 119;
+        gdraw.fillRect(313, vsiTop, 7, abs(vsi), TFT_ORANGE);
+    }
+
+    // vsi ladder, every 20 pixels
+    drawLadder(19, 220, 20, TFT_BLACK);
+}
+
+// -----------------------------------------------
+
 void AiGraph(int16_t px0, int16_t py0, int16_t arcSize, int16_t arcWidth, int16_t maxDisplay, int16_t minDisplay,
              int16_t startAngle, int16_t arcAngle, bool clockWise, uint8_t gradMarks,
-             int16_t pitch, int16_t roll, int16_t yaw, float flightPathAngle)
+             float pitch, float roll, int16_t yaw, float flightPathAngle)
 {
 
     /*
@@ -1061,20 +1859,22 @@ void AiGraph(int16_t px0, int16_t py0, int16_t arcSize, int16_t arcWidth, int16_
       */
     {
 
-        gdraw.fillSprite(TFT_CYAN);
+        gdraw.fillRect(0, 0, WIDTH, HEIGHT, TFT_CYAN); // fillSprite is not damage tracked
         arcSize = 160;
 
         /*
         Establish a wide horizontal baseline segment
         */
-        float xRotate = (2.0f * (float)WIDTH) * cos(roll * DEG_TO_RAD);
-        float yRotate = (2.0f * (float)WIDTH) * sin(roll * DEG_TO_RAD);
+        float sinRoll, cosRoll;
+        fastSinCos(roll * DEG_TO_RAD, sinRoll, cosRoll);
+        float xRotate = (2.0f * (float)WIDTH) * cosRoll;
+        float yRotate = (2.0f * (float)WIDTH) * sinRoll;
 
         /*
         Adjust it for roll and pitch
         */
-        float pxc = px0 + pitch * HEIGHT / 80 * sin(roll * DEG_TO_RAD);
-        float pyc = py0 + pitch * HEIGHT / 80 * cos(roll * DEG_TO_RAD);
+        float pxc = px0 + pitch * HEIGHT / 80 * sinRoll;
+        float pyc = py0 + pitch * HEIGHT / 80 * cosRoll;
 
         float px1 = pxc - xRotate;
         float py1 = pyc + yRotate;
@@ -1087,11 +1887,11 @@ void AiGraph(int16_t px0, int16_t py0, int16_t arcSize, int16_t arcWidth, int16_
         /*
         Compute offset parallel line segment to establish a wide bar
         */
-        float px3 = px1 + 3 * HEIGHT * cos(roll * DEG_TO_RAD - HALF_PI);
-        float py3 = py1 - 3 * HEIGHT * sin(-roll * DEG_TO_RAD - HALF_PI);
+        float px3 = px1 + 3 * HEIGHT * sinRoll; // a quarter turn on from the roll
+        float py3 = py1 + 3 * HEIGHT * cosRoll;
 
-        float px4 = px2 - 3 * HEIGHT * cos(roll * DEG_TO_RAD + HALF_PI);
-        float py4 = py2 + 3 * HEIGHT * sin(roll * DEG_TO_RAD + HALF_PI);
+        float px4 = px2 + 3 * HEIGHT * sinRoll;
+        float py4 = py2 + 3 * HEIGHT * cosRoll;
 
         /*
         Fill the bar.  Will be automatically clipped outside of screen bounds
@@ -1132,7 +1932,7 @@ void AiGraph(int16_t px0, int16_t py0, int16_t arcSize, int16_t arcWidth, int16_
     myGauges.setPointer(8, 0, 0, 0, '\0');
 
     myGauges.arcGraph(px0, py0, arcSize, arcWidth, maxDisplay, minDisplay,
-                      -roll, arcAngle, clockWise, gradMarks);
+                      -lroundf(roll), arcAngle, clockWise, gradMarks);
 
     /*
     Draw additional small markers
@@ -1154,8 +1954,25 @@ void AiGraph(int16_t px0, int16_t py0, int16_t arcSize, int16_t arcWidth, int16_
     myGauges.setPointer(8, 0, 0, 0, '\0');
 
     myGauges.arcGraph(px0, py0, arcSize, arcWidth, maxDisplay, minDisplay,
-                      -roll, arcAngle, clockWise, gradMarks);
+                      -lroundf(roll), arcAngle, clockWise, gradMarks);
+
+    bool outlines = qualityGovernor.level < qualityNoOutlines;
+    (outlines ? planeOutlinedSymbol : planeSymbol).draw(gdraw, px0, py0);
+    (outlines ? pointerOutlinedSymbol : pointerSymbol).draw(gdraw, px0, py0);
+
+    // 120 -screen center
+    int fpY = flightPathY(flightPathAngle, pitch);
+    int fpX = 159; // screen center
+    flightPathSymbol.draw(gdraw, fpX, fpY);
+}
+
+// -----------------------------------------------
+
+// Symbols of the attitude page, drawn once into Symbol runs (Symbol.h) and anchored at the
+// centre of the horizon arcs, or the flight path marker's centre.
 
+void drawPlane(TFT_eSPI &out, int16_t px0, int16_t py0, bool outlines)
+{
     /*
       Draw Airplane
 
@@ -1166,113 +1983,175 @@ void AiGraph(int16_t px0, int16_t py0, int16_t arcSize, int16_t arcWidth, int16_
              p5
     */
 
-    arcSize = 100;
-    arcWidth = 15;
+    int16_t arcSize = 100;
+
+    int16_t px1 = px0 - arcSize;
+    int16_t py1 = py0;
+    int16_t px2 = px0 - arcSize / 4;
+    int16_t py2 = py0;
+    int16_t px3 = px0 + arcSize / 4;
+    int16_t py3 = py0;
+    int16_t px4 = px0 + arcSize;
+    int16_t py4 = py0;
+    int16_t px5 = px0;
+    int16_t py5 = py0 + arcSize / 4;
+
+    out.fillCircle(px0, py0, 2 * HEIGHT / 80, TFT_YELLOW); // 2 degree radius circle
+    if (outlines)
+        out.drawCircle(px0, py0, 2 * HEIGHT / 80, TFT_BLACK);
+
+    out.drawFastHLine(px1, py1, 3 * arcSize / 4, TFT_YELLOW);
+    out.drawLine(px2, py2, px5, py5, TFT_YELLOW);
+    out.drawLine(px5, py5, px3, py3, TFT_YELLOW);
+    out.drawFastHLine(px3, py3, 3 * arcSize / 4, TFT_YELLOW);
+
+    out.drawFastHLine(px1, py1 - 1, 3 * arcSize / 4, TFT_YELLOW);
+    out.drawLine(px2, py2 - 1, px5, py5 - 1, TFT_YELLOW);
+    out.drawLine(px5, py5 - 1, px3, py3 - 1, TFT_YELLOW);
+    out.drawFastHLine(px3, py3 - 1, 3 * arcSize / 4, TFT_YELLOW);
+
+    out.drawFastHLine(px1, py1 - 2, 3 * arcSize / 4, TFT_YELLOW);
+    out.drawLine(px2, py2 - 2, px5, py5 - 2, TFT_YELLOW);
+    out.drawLine(px5, py5 - 2, px3, py3 - 2, TFT_YELLOW);
+    out.drawFastHLine(px3, py3 - 2, 3 * arcSize / 4, TFT_YELLOW);
+
+    if (outlines)
+    {
+        out.drawFastHLine(px1, py1 - 3, 3 * arcSize / 4, TFT_BLACK);
+        out.drawLine(px2, py2 - 3, px5, py5 - 3, TFT_BLACK);
+        out.drawLine(px5, py5 - 3, px3, py3 - 3, TFT_BLACK);
+        out.drawFastHLine(px3, py3 - 3, 3 * arcSize / 4, TFT_BLACK);
+    }
 
-    uint16_t px1 = px0 - arcSize;
-    uint16_t py1 = py0;
-    uint16_t px2 = px0 - arcSize / 4;
-    uint16_t py2 = py0;
-    uint16_t px3 = px0 + arcSize / 4;
-    uint16_t py3 = py0;
-    uint16_t px4 = px0 + arcSize;
-    uint16_t py4 = py0;
-    uint16_t px5 = px0;
-    uint16_t py5 = py0 + arcSize / 4;
-
-    gdraw.fillCircle(px0, py0, 2 * HEIGHT / 80, TFT_YELLOW); // 2 degree radius circle
-    gdraw.drawCircle(px0, py0, 2 * HEIGHT / 80, TFT_BLACK);
-
-    gdraw.drawFastHLine(px1, py1, 3 * arcSize / 4, TFT_YELLOW);
-    gdraw.drawLine(px2, py2, px5, py5, TFT_YELLOW);
-    gdraw.drawLine(px5, py5, px3, py3, TFT_YELLOW);
-    gdraw.drawFastHLine(px3, py3, 3 * arcSize / 4, TFT_YELLOW);
-
-    gdraw.drawFastHLine(px1, py1 - 1, 3 * arcSize / 4, TFT_YELLOW);
-    gdraw.drawLine(px2, py2 - 1, px5, py5 - 1, TFT_YELLOW);
-    gdraw.drawLine(px5, py5 - 1, px3, py3 - 1, TFT_YELLOW);
-    gdraw.drawFastHLine(px3, py3 - 1, 3 * arcSize / 4, TFT_YELLOW);
-
-    gdraw.drawFastHLine(px1, py1 - 2, 3 * arcSize / 4, TFT_YELLOW);
-    gdraw.drawLine(px2, py2 - 2, px5, py5 - 2, TFT_YELLOW);
-    gdraw.drawLine(px5, py5 - 2, px3, py3 - 2, TFT_YELLOW);
-    gdraw.drawFastHLine(px3, py3 - 2, 3 * arcSize / 4, TFT_YELLOW);
-
-    gdraw.drawFastHLine(px1, py1 - 3, 3 * arcSize / 4, TFT_BLACK);
-    gdraw.drawLine(px2, py2 - 3, px5, py5 - 3, TFT_BLACK);
-    gdraw.drawLine(px5, py5 - 3, px3, py3 - 3, TFT_BLACK);
-    gdraw.drawFastHLine(px3, py3 - 3, 3 * arcSize / 4, TFT_BLACK);
-
-    gdraw.drawFastHLine(px1, py1 + 1, 3 * arcSize / 4, TFT_YELLOW);
-    gdraw.drawLine(px2, py2 + 1, px5, py5 + 1, TFT_YELLOW);
-    gdraw.drawLine(px5, py5 + 1, px3, py3 + 1, TFT_YELLOW);
-    gdraw.drawFastHLine(px3, py3 + 1, 3 * arcSize / 4, TFT_YELLOW);
-
-    gdraw.drawFastHLine(px1, py1 + 2, 3 * arcSize / 4, TFT_YELLOW);
-    gdraw.drawLine(px2, py2 + 2, px5, py5 + 2, TFT_YELLOW);
-    gdraw.drawLine(px5, py5 + 2, px3, py3 + 2, TFT_YELLOW);
-    gdraw.drawFastHLine(px3, py3 + 2, 3 * arcSize / 4, TFT_YELLOW);
-
-    gdraw.drawFastHLine(px1, py1 + 3, 3 * arcSize / 4, TFT_BLACK);
-    gdraw.drawLine(px2, py2 + 3, px5, py5 + 3, TFT_BLACK);
-    gdraw.drawLine(px5, py5 + 3, px3, py3 + 3, TFT_BLACK);
-    gdraw.drawFastHLine(px3, py3 + 3, 3 * arcSize / 4, TFT_BLACK);
-
-    gdraw.drawFastVLine(px1, py1 - 3, 6, TFT_BLACK);
-    gdraw.drawFastVLine(px4, py4 - 3, 6, TFT_BLACK);
+    out.drawFastHLine(px1, py1 + 1, 3 * arcSize / 4, TFT_YELLOW);
+    out.drawLine(px2, py2 + 1, px5, py5 + 1, TFT_YELLOW);
+    out.drawLine(px5, py5 + 1, px3, py3 + 1, TFT_YELLOW);
+    out.drawFastHLine(px3, py3 + 1, 3 * arcSize / 4, TFT_YELLOW);
 
-    /*
-    Draw top pointer
-    */
+    out.drawFastHLine(px1, py1 + 2, 3 * arcSize / 4, TFT_YELLOW);
+    out.drawLine(px2, py2 + 2, px5, py5 + 2, TFT_YELLOW);
+    out.drawLine(px5, py5 + 2, px3, py3 + 2, TFT_YELLOW);
+    out.drawFastHLine(px3, py3 + 2, 3 * arcSize / 4, TFT_YELLOW);
 
-    px1 = px0;
-    py1 = py0 - arcSize + arcWidth / 2;
-    px2 = px0 - arcWidth / 2;
-    py2 = py0 - arcSize + 2 * arcWidth;
-    px3 = px0 + arcWidth / 2;
-    py3 = py0 - arcSize + 2 * arcWidth;
+    if (outlines)
+    {
+        out.drawFastHLine(px1, py1 + 3, 3 * arcSize / 4, TFT_BLACK);
+        out.drawLine(px2, py2 + 3, px5, py5 + 3, TFT_BLACK);
+        out.drawLine(px5, py5 + 3, px3, py3 + 3, TFT_BLACK);
+        out.drawFastHLine(px3, py3 + 3, 3 * arcSize / 4, TFT_BLACK);
 
-    gdraw.fillTriangle(px1, py1, px2, py2, px3, py3, TFT_YELLOW);
+        out.drawFastVLine(px1, py1 - 3, 6, TFT_BLACK);
+        out.drawFastVLine(px4, py4 - 3, 6, TFT_BLACK);
+    }
+}
 
-    gdraw.drawLine(px1, py1, px2, py2, TFT_BLACK);
-    gdraw.drawLine(px2, py2, px3, py3, TFT_BLACK);
-    gdraw.drawLine(px3, py3, px1, py1, TFT_BLACK);
+void drawTopPointer(TFT_eSPI &out, int16_t px0, int16_t py0, bool outlines)
+{
+    int16_t arcSize = 100;
+    int16_t arcWidth = 15;
 
-    /*
-    Draw FlightPath marker
-    */
+    int16_t px1 = px0;
+    int16_t py1 = py0 - arcSize + arcWidth / 2;
+    int16_t px2 = px0 - arcWidth / 2;
+    int16_t py2 = py0 - arcSize + 2 * arcWidth;
+    int16_t px3 = px0 + arcWidth / 2;
+    int16_t py3 = py0 - arcSize + 2 * arcWidth;
 
-    // 120 -screen center
-    int fpY = 120 - (FlightPath - Pitch) * 120 / 40; // 40 degrees of pitch per half screen height
-    // if (fpY<0) fpY=0;
-    // if (fpY>239) fpY=239;
-    fpY = constrain(fpY, 0, 239);
-    int fpX = 159; // screen center
+    out.fillTriangle(px1, py1, px2, py2, px3, py3, TFT_YELLOW);
 
+    if (outlines)
+    {
+        out.drawLine(px1, py1, px2, py2, TFT_BLACK);
+        out.drawLine(px2, py2, px3, py3, TFT_BLACK);
+        out.drawLine(px3, py3, px1, py1, TFT_BLACK);
+    }
+}
+
+void drawFlightPath(TFT_eSPI &out, int16_t fpX, int16_t fpY)
+{
     // circle
-    gdraw.drawCircle(fpX, fpY, 12, TFT_MAGENTA);
-    gdraw.drawCircle(fpX, fpY, 13, TFT_MAGENTA);
-    gdraw.drawCircle(fpX, fpY, 14, TFT_MAGENTA);
+    out.drawCircle(fpX, fpY, 12, TFT_MAGENTA);
+    out.drawCircle(fpX, fpY, 13, TFT_MAGENTA);
+    out.drawCircle(fpX, fpY, 14, TFT_MAGENTA);
 
     // left line
-    gdraw.drawLine(fpX - 33, fpY - 1, fpX - 14, fpY - 1, TFT_MAGENTA);
-    gdraw.drawLine(fpX - 33, fpY, fpX - 14, fpY, TFT_MAGENTA);
-    gdraw.drawLine(fpX - 33, fpY + 1, fpX - 14, fpY + 1, TFT_MAGENTA);
+    out.drawLine(fpX - 33, fpY - 1, fpX - 14, fpY - 1, TFT_MAGENTA);
+    out.drawLine(fpX - 33, fpY, fpX - 14, fpY, TFT_MAGENTA);
+    out.drawLine(fpX - 33, fpY + 1, fpX - 14, fpY + 1, TFT_MAGENTA);
 
     // right line
-    gdraw.drawLine(fpX + 33, fpY - 1, fpX + 14, fpY - 1, TFT_MAGENTA);
-    gdraw.drawLine(fpX + 33, fpY, fpX + 14, fpY, TFT_MAGENTA);
-    gdraw.drawLine(fpX + 33, fpY + 1, fpX + 14, fpY + 1, TFT_MAGENTA);
+    out.drawLine(fpX + 33, fpY - 1, fpX + 14, fpY - 1, TFT_MAGENTA);
+    out.drawLine(fpX + 33, fpY, fpX + 14, fpY, TFT_MAGENTA);
+    out.drawLine(fpX + 33, fpY + 1, fpX + 14, fpY + 1, TFT_MAGENTA);
 
     // top line
-    gdraw.drawLine(fpX - 1, fpY - 14, fpX - 1, fpY - 33, TFT_MAGENTA);
-    gdraw.drawLine(fpX, fpY - 14, fpX, fpY - 33, TFT_MAGENTA);
-    gdraw.drawLine(fpX + 1, fpY - 14, fpX + 1, fpY - 33, TFT_MAGENTA);
+    out.drawLine(fpX - 1, fpY - 14, fpX - 1, fpY - 33, TFT_MAGENTA);
+    out.drawLine(fpX, fpY - 14, fpX, fpY - 33, TFT_MAGENTA);
+    out.drawLine(fpX + 1, fpY - 14, fpX + 1, fpY - 33, TFT_MAGENTA);
+}
+
+// the two levels of detail of the plane and pointer
+
+void drawPlaneOutlined(TFT_eSPI &out, int16_t x, int16_t y)
+{
+    drawPlane(out, x, y, true);
+}
+
+void drawPlaneFilled(TFT_eSPI &out, int16_t x, int16_t y)
+{
+    drawPlane(out, x, y, false);
+}
+
+void drawTopPointerOutlined(TFT_eSPI &out, int16_t x, int16_t y)
+{
+    drawTopPointer(out, x, y, true);
+}
+
+void drawTopPointerFilled(TFT_eSPI &out, int16_t x, int16_t y)
+{
+    drawTopPointer(out, x, y, false);
+}
+
+// -----------------------------------------------
+
+// Red X across the screen with NO DATA in the middle, for a serial link failure
+
+void drawNoData(TFT_eSPI &out, int16_t x, int16_t y)
+{
+    out.drawLine(x, y, x + 319, y + 239, TFT_RED); // center
+
+    out.drawLine(x, y + 1, x + 318, y + 239, TFT_RED); // left
+    out.drawLine(x, y + 2, x + 317, y + 239, TFT_RED);
+    out.drawLine(x, y + 3, x + 316, y + 239, TFT_RED);
+    out.drawLine(x, y + 4, x + 315, y + 239, TFT_RED);
+
+    out.drawLine(x + 1, y, x + 319, y + 238, TFT_RED); // right
+    out.drawLine(x + 2, y, x + 319, y + 237, TFT_RED);
+    out.drawLine(x + 3, y, x + 319, y + 236, TFT_RED);
+    out.drawLine(x + 4, y, x + 319, y + 235, TFT_RED);
+
+    out.drawLine(x, y + 239, x + 319, y, TFT_RED); // center
+
+    out.drawLine(x, y + 238, x + 318, y, TFT_RED); // left
+    out.drawLine(x, y + 237, x + 317, y, TFT_RED);
+    out.drawLine(x, y + 236, x + 316, y, TFT_RED);
+    out.drawLine(x, y + 235, x + 315, y, TFT_RED);
+
+    out.drawLine(x + 1, y + 239, x + 319, y + 1, TFT_RED); // right
+    out.drawLine(x + 2, y + 239, x + 319, y + 2, TFT_RED);
+    out.drawLine(x + 3, y + 239, x + 319, y + 3, TFT_RED);
+    out.drawLine(x + 4, y + 239, x + 319, y + 4, TFT_RED);
+
+    out.setFreeFont(FSSB18);
+    out.setTextColor(TFT_WHITE);
+    out.setTextDatum(MC_DATUM);
+    out.fillRect(x + 100, y + 100, 120, 40, TFT_BLACK);
+    out.drawString("NO DATA", x + 160, y + 120);
 }
 
 // -----------------------------------------------
 
-void pitchGraph(int16_t pitch, int16_t roll, int16_t px0, int16_t py0, uint8_t scale)
+void pitchGraph(float pitch, float roll, int16_t px0, int16_t py0, uint8_t scale)
 {
 
     /* Draw Pitch scale
@@ -1298,8 +2177,11 @@ void pitchGraph(int16_t pitch, int16_t roll, int16_t px0, int16_t py0, uint8_t s
     float xRotate;
     float yRotate;
 
-    float pxc = px0 + pitch * HEIGHT / 80 * sin(roll * DEG_TO_RAD);
-    float pyc = py0 + pitch * HEIGHT / 80 * cos(roll * DEG_TO_RAD);
+    float sinRoll, cosRoll;
+    fastSinCos(roll * DEG_TO_RAD, sinRoll, cosRoll);
+
+    float pxc = px0 + pitch * HEIGHT / 80 * sinRoll;
+    float pyc = py0 + pitch * HEIGHT / 80 * cosRoll;
 
     /*
       Compute pitch scale
@@ -1307,8 +2189,8 @@ void pitchGraph(int16_t pitch, int16_t roll, int16_t px0, int16_t py0, uint8_t s
 
     gdraw.setTextDatum(MC_DATUM);
 
-    xRotate = (0.10f * arcSize) * cos(roll * DEG_TO_RAD); // establish the width.
-    yRotate = (0.10f * arcSize) * sin(roll * DEG_TO_RAD);
+    xRotate = (0.10f * arcSize) * cosRoll; // establish the width.
+    yRotate = (0.10f * arcSize) * sinRoll;
 
     px1 = pxc - xRotate * 1.0f;
     py1 = pyc + yRotate * 1.0f;
@@ -1319,11 +2201,11 @@ void pitchGraph(int16_t pitch, int16_t roll, int16_t px0, int16_t py0, uint8_t s
     for (int16_t i = -85; i <= 85; i += scale)
     {
         // Marks every 5 degrees
-        px3 = px1 - (i * HEIGHT / 80) * cos(roll * DEG_TO_RAD - HALF_PI);
-        py3 = py1 + (i * HEIGHT / 80) * sin(-roll * DEG_TO_RAD - HALF_PI);
+        px3 = px1 - (i * HEIGHT / 80) * sinRoll;
+        py3 = py1 - (i * HEIGHT / 80) * cosRoll;
 
-        px4 = px2 + (i * HEIGHT / 80) * cos(roll * DEG_TO_RAD + HALF_PI);
-        py4 = py2 - (i * HEIGHT / 80) * sin(roll * DEG_TO_RAD + HALF_PI);
+        px4 = px2 - (i * HEIGHT / 80) * sinRoll;
+        py4 = py2 - (i * HEIGHT / 80) * cosRoll;
 
         gdraw.drawLine(px3, py3, px4, py4, TFT_BLACK);
     }
@@ -1334,41 +2216,47 @@ void pitchGraph(int16_t pitch, int16_t roll, int16_t px0, int16_t py0, uint8_t s
     px2 = pxc + xRotate * 2.0f;
     py2 = pyc - yRotate * 2.0f;
 
+    // fewer labels when the frame budget is tight
+    uint8_t labelStep = qualityLabelStep[qualityGovernor.level];
+
     for (int16_t i = -90; i <= 90; i += scale)
     {
         // Marks every 5 degrees
-        px3 = px1 - (i * HEIGHT / 80) * cos(roll * DEG_TO_RAD - HALF_PI);
-        py3 = py1 + (i * HEIGHT / 80) * sin(-roll * DEG_TO_RAD - HALF_PI);
+        px3 = px1 - (i * HEIGHT / 80) * sinRoll;
+        py3 = py1 - (i * HEIGHT / 80) * cosRoll;
 
-        px4 = px2 + (i * HEIGHT / 80) * cos(roll * DEG_TO_RAD + HALF_PI);
-        py4 = py2 - (i * HEIGHT / 80) * sin(roll * DEG_TO_RAD + HALF_PI);
+        px4 = px2 - (i * HEIGHT / 80) * sinRoll;
+        py4 = py2 - (i * HEIGHT / 80) * cosRoll;
 
         gdraw.setCursor(px4, py4);
         gdraw.drawLine(px3, py3, px4, py4, TFT_BLACK);
 
+        if (labelStep == 0 || i % labelStep != 0)
+            continue;
+
         px4 += xRotate * 0.75f;
         py4 -= yRotate * 0.75f;
+
+        // labels well off screen are not drawn at all
+        if (px4 < -40 || px4 > WIDTH + 40 || py4 < -40 || py4 > HEIGHT + 40)
+            continue;
+
         // myGauges.printNum ("123456789", 160, 120, 8, 12, roll, TFT_BLACK, MR_DATUM);
-        myGauges.printNum(String(i) + "o", px4, py4, 8, 12, roll, TFT_BLACK, ML_DATUM);
+        myGauges.printNum(String(i) + "o", px4, py4, 8, 12, lroundf(roll), TFT_BLACK, ML_DATUM);
     }
 } // end pitchGraph
 
 // -----------------------------------------------
 
-void displayDecelGauge()
+// Constant parts of the decel page
+
+void displayDecelStatic()
 {
     // draw gauge background
     gdraw.fillRoundRect(109, 1, 102, 210, 5, TFT_RED);
     gdraw.fillRect(109, 87, 102, 36, TFT_GREEN);
     gdraw.drawRoundRect(109, 1, 102, 210, 5, TFT_LIGHTGREY);
 
-    int decelIndex = int(35.143 * SmoothedDecelRate + 141.48 - 3.5); // 3.5 is half the indexer pointer height
-    decelIndex = constrain(decelIndex, 2, 205);
-
-    // draw index pointer
-    gdraw.fillRect(109, decelIndex, 102, 7, TFT_WHITE);
-    gdraw.drawRect(109, decelIndex, 102, 7, TFT_BLACK);
-
     // gauge numbers
     gdraw.setFreeFont(FSS9);
     gdraw.setTextColor(TFT_WHITE);
@@ -1386,43 +2274,60 @@ void displayDecelGauge()
     gdraw.drawLine(99, 141, 107, 141, TFT_LIGHTGREY);
     gdraw.drawLine(99, 177, 107, 177, TFT_LIGHTGREY);
 
+    // vsi ladder, every 20 pixels
+    drawLadder(19, 220, 20, TFT_LIGHTGREY);
+
+    // labels
+    gdraw.setFreeFont(FSS18);
+    gdraw.setCursor(5, 90);
+    gdraw.setTextColor(TFT_GREEN);
+    gdraw.print("IAS");
+    gdraw.setTextColor(TFT_GREEN);
+    gdraw.setTextDatum(TR_DATUM);
+    gdraw.drawString("Kt/s", 305, 65);
+
+    gdraw.setFreeFont(FSS12);
+    gdraw.setTextColor(TFT_GREEN);
+    gdraw.setTextDatum(TR_DATUM);
+    gdraw.drawString("Ps fpm", 305, 150);
+}
+
+// -----------------------------------------------
+
+int decelPointerY()
+{
+    int decelIndex = int(35.143 * SmoothedDecelRate + 141.48 - 3.5); // 3.5 is half the indexer pointer height
+    return constrain(decelIndex, 2, 205);
+}
+
+void displayDecelGauge()
+{
+    int decelIndex = decelPointerY();
+
+    // draw index pointer
+    gdraw.fillRect(109, decelIndex, 102, 7, TFT_WHITE);
+    gdraw.drawRect(109, decelIndex, 102, 7, TFT_BLACK);
+
     // iVSI
     // draw iVSI line
-    if (iVSI != 0.0)
+    int16_t vsi = vsiBar();
+    if (vsi != 0)
     {
-        int vsiHeight = abs(int(iVSI * 120 / 600));
-        vsiHeight = constrain(vsiHeight, 0, 120);
         int vsiTop;
-        if (iVSI > 0)
-            vsiTop = 119 - vsiHeight;
+        if (vsi > 0)
+            vsiTop = 119 - vsi;
         else
             vsiTop = 119;
-        gdraw.fillRect(313, vsiTop, 7, vsiHeight, TFT_ORANGE);
-    }
+        gdraw.fillRect(313, vsiTop, 7, abs(vsi), TFT_ORANGE);
 
-    // vsi ladder, every 20 pixels
-    for (int i = 19; i < 220; i = i + 20)
-    {
-        gdraw.drawLine(313, i, 319, i, TFT_LIGHTGREY);
+        // ladder stays on top of the bar
+        drawLadder(19, 220, 20, TFT_LIGHTGREY);
     }
 
-    // zero line
-    gdraw.drawLine(306, 118, 312, 118, TFT_LIGHTGREY);
-    gdraw.drawLine(306, 119, 312, 119, TFT_LIGHTGREY);
-    gdraw.drawLine(306, 120, 312, 120, TFT_LIGHTGREY);
-
     // Update ball display
-    drawSlip(80, 215, 160, 20, Slip, false, AOAThresholds);
+    drawSlip(80, 215, 160, 20, lroundf(renderFrame.Slip), false, AOAThresholds);
 
     // Update airspeed numeric display
-    gdraw.setFreeFont(FSS18);
-    gdraw.setCursor(5, 90);
-    gdraw.setTextColor(TFT_GREEN);
-    gdraw.print("IAS");
-    gdraw.setTextColor(TFT_GREEN);
-    gdraw.setTextDatum(TR_DATUM);
-    gdraw.drawString("Kt/s", 305, 65);
-
     gdraw.setFreeFont(FSSB18);
 
     // update IAS numeric display
@@ -1433,31 +2338,32 @@ void displayDecelGauge()
     // Update G-force numeric display
     gdraw.setFreeFont(FSSB18);
     gdraw.setTextColor(TFT_WHITE);
-    char DecelStr[5];
-    sprintf(DecelStr, "%+1.1f", displayDecelRate);
+    Readouts text;
+    formatReadouts(text);
+    gdraw.setTextDatum(MR_DATUM);
+    gdraw.drawString(text.decel, 305, 118);
+
+    // Update specific excess power (Ps) display
+    gdraw.setFreeFont(FSSB12);
+    gdraw.setTextColor(TFT_WHITE);
     gdraw.setTextDatum(MR_DATUM);
-    gdraw.drawString(DecelStr, 305, 118);
+    gdraw.drawString(text.ps, 305, 190);
 }
 
 // -----------------------------------------------
 
-void displayGloadHistory()
-{
+// Constant parts of the G history page
 
+void displayGloadStatic()
+{
     // 1G line
-    gdraw.drawLine(19, 133, 319, 133, TFT_WHITE);
+    gdraw.drawLine(19, gOneY, 319, gOneY, TFT_WHITE);
 
     // vertical line
     gdraw.drawLine(19, 0, 19, 239, TFT_WHITE);
 
-    gdraw.drawLine(19, 27, 319, 27, TFT_LIGHTGREY);
-    gdraw.drawLine(19, 53, 319, 53, TFT_LIGHTGREY);
-    gdraw.drawLine(19, 80, 319, 80, TFT_LIGHTGREY);
-    gdraw.drawLine(19, 106, 319, 106, TFT_LIGHTGREY);
-
-    gdraw.drawLine(19, 160, 319, 160, TFT_LIGHTGREY);
-    gdraw.drawLine(19, 186, 319, 186, TFT_LIGHTGREY);
-    gdraw.drawLine(19, 213, 319, 213, TFT_LIGHTGREY);
+    for (uint8_t i = 0; i < sizeof(gGridY) / sizeof(gGridY[0]); i++)
+        gdraw.drawLine(19, gGridY[i], 319, gGridY[i], TFT_LIGHTGREY);
 
     // pips
     gdraw.setFreeFont(FSS12);
@@ -1472,33 +2378,124 @@ void displayGloadHistory()
     gdraw.drawString("-1", 12, 186);
     gdraw.drawString("-2", 12, 213);
 
-    gdraw.setFreeFont(FSS12);
-    gdraw.setTextDatum(MC_DATUM);
-    gdraw.drawString("G-LOAD [1 min]", 160, 12);
-
-    // draw gHistory
-    int gDisplayIndex = gHistoryIndex;
-    uint16_t gColor;
-    for (int i = 319; i > 19; i--)
+    // the title would move with the plot in the panel's scroll area
+    if (!gPlotScrolled)
     {
-        int gHeight = 160 - int(gHistory[gDisplayIndex] * 26.67);
-        gHeight = constrain(gHeight, 0, 239);
+        gdraw.setFreeFont(FSS12);
+        gdraw.setTextDatum(MC_DATUM);
+        gdraw.drawString("G-LOAD [1 min]", 160, 12);
+    }
+}
 
-        if (gHistory[gDisplayIndex] >= 1)
-            gColor = TFT_GREEN;
-        else if (gHistory[gDisplayIndex] < 1 && gHistory[gDisplayIndex] >= 0)
-            gColor = TFT_YELLOW;
-        else
-            gColor = TFT_RED;
+// -----------------------------------------------
+
+void displayGloadHistory()
+{
+    if (!gChart.draw(gdraw))
+        displayGloadDots();
+} // end displayGloadHistory()
+
+// every sample of gHistory as a dot, newest on the left, when the strip chart has no columns
 
-        gdraw.fillCircle(i, gHeight, 2, gColor);
+void displayGloadDots()
+{
+    int gDisplayIndex = gHistoryIndex;
+    for (int i = 319; i >= gPlotLeft; i--)
+    {
+        gdraw.fillCircle(i, gPlotY(gHistory[gDisplayIndex]), 2, gPlotColour(gHistory[gDisplayIndex]));
 
         if (gDisplayIndex < 299)
             gDisplayIndex++;
         else
             gDisplayIndex = 0;
     }
-} // end displayGloadHistory()
+}
+
+int16_t gPlotY(float g)
+{
+    int gHeight = 160 - int(g * 26.67);
+    return constrain(gHeight, 0, 239);
+}
+
+uint16_t gPlotColour(float g)
+{
+    if (g >= 1)
+        return TFT_GREEN;
+    else if (g >= 0)
+        return TFT_YELLOW;
+    return TFT_RED;
+}
+
+// -----------------------------------------------
+
+// The G load page moves its plot with the panel's scroll area (PanelScroll.h) instead of
+// pushing frames.  The first frame is rendered and pushed as usual with the panel at rest;
+// after that each new sample moves the scroll area one column right, and only the column that
+// came round to the left is written, 480 bytes instead of a frame.  Without the strip chart's
+// columns the page is rendered every frame.  false if the page is not drawn this way.
+
+bool scrollPage()
+{
+    if (!displayPages[displayType].scrolled)
+    {
+        endScroll();
+        return false;
+    }
+
+    if (!panelScroll.active())
+    {
+        gColumn.setColorDepth(16);
+        if (gChart.columns() == 0 || gColumn.createSprite(1, HEIGHT) == NULL)
+            return false; // redrawn every frame instead
+
+        renderPage(true);
+        frameSprite.pushFrame();
+        frameSprite.fence(); // on the panel before it moves
+        panelScroll.begin(gPlotLeft, WIDTH - gPlotLeft);
+        gScrollIndex = gHistoryIndex;
+        return true;
+    }
+
+    // samples since the last frame, oldest first
+    for (int k = (gHistoryIndex - gScrollIndex + 300) % 300 - 1; k >= 0; k--)
+    {
+        panelScroll.stepRight();
+        drawGColumn(k);
+    }
+    gScrollIndex = gHistoryIndex;
+    return true;
+}
+
+// Back to full frames: the panel at rest, and every tile sent again by the next push.
+
+void endScroll()
+{
+    if (!panelScroll.active())
+        return;
+    panelScroll.end();
+    gColumn.deleteSprite();
+    frameSprite.invalidate();
+}
+
+// The plot's left column as a full frame would show it with chart column k there, written to
+// the frame memory column the panel shows there now.  The column is 16 bit, so its colours are
+// brought to those the frame buffer shows the rest of the plot in.
+
+void drawGColumn(int16_t k)
+{
+    gColumn.fillSprite(TFT_BLACK);
+    gColumn.drawPixel(0, gOneY, TFT_WHITE);
+    for (uint8_t i = 0; i < sizeof(gGridY) / sizeof(gGridY[0]); i++)
+        gColumn.drawPixel(0, gGridY[i], TFT_LIGHTGREY);
+    gChart.drawColumn(gColumn, k, 0);
+    for (int16_t y = 0; y < HEIGHT; y++)
+    {
+        uint16_t color = gColumn.readPixel(0, y);
+        if (color != TFT_BLACK)
+            gColumn.drawPixel(0, y, frameSprite.shownColor(color));
+    }
+    gColumn.pushSprite(panelScroll.memoryX(gPlotLeft), 0);
+}
 
 // -----------------------------------------------
 
@@ -1673,16 +2670,7 @@ void handleIndex()
 
 unsigned int checkSerial()
 {
-    gdraw.setColorDepth(8);
-    gdraw.createSprite(WIDTH, HEIGHT);
-    gdraw.fillSprite(TFT_BLACK);
-    gdraw.setFreeFont(FSS12);
-    gdraw.setTextDatum(MC_DATUM);
-    gdraw.setTextColor(TFT_WHITE);
-    gdraw.drawString("Looking for Serial data", 160, 120);
-    gdraw.drawString("Please wait...", 160, 190);
-    gdraw.pushSprite(0, 0);
-    gdraw.deleteSprite();
+    showScreen(SCREEN_SERIAL_SEARCH);
     String serialString;
 
     // TTL input (including v2 Onspeed with vern's power board)
@@ -1731,25 +2719,147 @@ String readSerialbytes()
 
 // -----------------------------------------------
 
-void displaySplashScreen()
+// Allocate the frame buffer sprite and the static page layer once at boot and keep them.
+// Also times the allocate/free cycle that used to run on every frame.
+
+void frameBufferSetup()
 {
-    // display splash screen and firmware upgrade option
-    gdraw.setFreeFont(FSSB24);
-    gdraw.setTextColor(TFT_WHITE);
-    gdraw.setTextDatum(MC_DATUM);
-    gdraw.drawString("Fly OnSpeed", 160, 60);
+    uint32_t allocMin = UINT32_MAX;
+    uint32_t allocMax = 0;
+    uint32_t allocSum = 0;
+    uint32_t allocCount = 0; // cycles that allocated, the loop stops at the first failure
+    const int allocCycles = 16;
+
+    gdraw.setColorDepth(FRAME_DEPTH);
+    for (int i = 0; i < allocCycles; i++)
+    {
+        uint32_t allocStart = micros();
+        bool allocated = gdraw.createSprite(WIDTH, HEIGHT) != NULL;
+        gdraw.deleteSprite();
+        uint32_t allocTime = micros() - allocStart;
 
-    gdraw.setFreeFont(FSS9);
-    gdraw.drawString("Version: " + String(firmwareVersion), 160, 120);
-    gdraw.drawString("To reset, hold Round button", 160, 200); 
-    gdraw.drawString("To upgrade, reset & hold Square button", 160, 220);
-    gdraw.pushSprite(0, 0);
-    gdraw.deleteSprite();
+        if (!allocated)
+            break;
+        allocSum += allocTime;
+        allocCount++;
+        if (allocTime < allocMin)
+            allocMin = allocTime;
+        if (allocTime > allocMax)
+            allocMax = allocTime;
+    }
+
+    if (gdraw.createSprite(WIDTH, HEIGHT) == NULL)
+    {
+        Serial.printf("Frame buffer allocation failed: %u bytes needed, %u free, largest block %u\n",
+                      FRAME_BYTES, ESP.getFreeHeap(), ESP.getMaxAllocHeap());
+
+        tft.fillScreen(TFT_BLACK);
+        tft.setFreeFont(FSSB12);
+        tft.setTextColor(TFT_RED);
+        tft.setTextDatum(MC_DATUM);
+        tft.drawString("Display memory error", 160, 100);
+        tft.setFreeFont(FSS12);
+        tft.setTextColor(TFT_WHITE);
+        tft.drawString("Frame buffer allocation failed", 160, 140);
+        while (true)
+            delay(1000); // never fly with a half working display
+    }
+
+    Serial.printf("Frame buffer: %u bit, %u bytes allocated once, %u bytes heap left\n", FRAME_DEPTH, FRAME_BYTES, ESP.getFreeHeap());
+    frameSprite.setPalette(pagePalette);
+    if (allocCount > 0)
+        Serial.printf("Per-frame createSprite/deleteSprite removed: avg %u us, min %u us, max %u us over %u cycles\n",
+                      allocSum / allocCount, allocMin, allocMax, allocCount);
+
+    // frames go out over SPI DMA while the loop carries on
+    if (frameSprite.beginDMA())
+    {
+        Serial.printf("DMA push: 2 x %u line buffers, %u bytes heap left\n", FRAME_DMA_LINES, ESP.getFreeHeap());
+        frameSprite.setExactColors(exactColors, sizeof(exactColors) / sizeof(exactColors[0])); // 8 bit only
+    }
+    else
+        Serial.println("DMA push not available, frames are pushed blocking");
+
+    // static page layer, the pages still work without it, just slower
+    if (frameSprite.createLayer())
+        Serial.printf("Static layer: %u bytes, %u bytes heap left\n", FRAME_BYTES, ESP.getFreeHeap());
+    else
+        Serial.printf("Static layer not allocated, %u bytes free, largest block %u\n", ESP.getFreeHeap(), ESP.getMaxAllocHeap());
+
+    // record draws, fill them on core 0 while the next frame is recorded
+    if (frameSprite.beginBands(FRAME_LIST_BYTES))
+        Serial.printf("Display list: 2 x %u bytes, %u bytes heap left\n", FRAME_LIST_BYTES, ESP.getFreeHeap());
+    else
+        Serial.println("Display list not available, drawing in immediate mode");
+
+    // widget caches, used while the draws are recorded
+    uint32_t widgetBytes = 0;
+    for (int16_t i = 0; i < widgetCount; i++)
+        if (widgets[i]->allocate())
+            widgetBytes += widgets[i]->cacheSize();
+    Serial.printf("Widget caches: %u bytes, %u bytes heap left\n", widgetBytes, ESP.getFreeHeap());
+
+    // the G history plot's columns, plotted sample by sample without them
+    Serial.printf("G strip chart: %u bytes%s\n", gChart.bytes(), gChart.allocate() ? "" : " not allocated");
+
+    // fixed shapes as runs of pixels, drawn line by line without them
+    uint32_t symbolBytes = 0;
+    for (int16_t i = 0; i < symbolCount; i++)
+        if (symbols[i]->rasterize(&tft))
+            symbolBytes += symbols[i]->bytes();
+        else
+            Serial.printf("Symbol %s not rasterized\n", symbols[i]->name);
+    Serial.printf("Symbols: %u bytes, %u bytes heap left\n", symbolBytes, ESP.getFreeHeap());
+
+    // the neighbouring pages' static layers, page switches draw them when these are missing
+    for (int16_t i = 0; i < 2; i++)
+        backdropDraws[i] = (uint8_t *)malloc(backdropBytes);
+    Serial.printf("Render ahead: 2 x %u bytes%s, %u bytes heap left\n", backdropBytes,
+                  backdropDraws[1] != NULL ? "" : " not allocated", ESP.getFreeHeap());
+}
+
+// -----------------------------------------------
+
+void displaySplashScreen()
+{
+    // display splash screen and firmware upgrade option, straight to the panel before the frame
+    // buffer is set up.  The version differs between builds and is drawn over the rest.
+    drawScreen(tft, SCREEN_SPLASH); // on the black panel setup() starts with
+    tft.setFreeFont(FSS9);
+    tft.setTextColor(TFT_WHITE);
+    tft.setTextDatum(MC_DATUM);
+    tft.drawString("Version: " + String(firmwareVersion), 160, 120);
     ButtonUpdate();
 }
 
 // -----------------------------------------------
 
+// Screens outside the pages (ScreenText.h), drawn into the frame buffer and pushed
+
+void showScreen(uint8_t screen)
+{
+    frameSprite.clear();
+    drawScreen(gdraw, screen);
+    frameSprite.pushFrame();
+}
+
+// the texts of a screen on black, into the frame buffer or straight to the panel
+void drawScreen(TFT_eSPI &out, uint8_t screen)
+{
+    static const GFXfont *const fonts[] = { FSS9, FSS12, FSSB12, FSSB24 }; // ScreenFont
+    const StaticScreen &texts = staticScreens[screen];
+
+    for (uint8_t i = 0; i < texts.count; i++)
+    {
+        out.setFreeFont(fonts[texts.texts[i].font]);
+        out.setTextColor(texts.texts[i].color);
+        out.setTextDatum(texts.texts[i].datum);
+        out.drawString(texts.texts[i].text, texts.texts[i].x, texts.texts[i].y);
+    }
+}
+
+// -----------------------------------------------
+
 void serialSetup()
 {
     preferences.begin("OnSpeed", false);
@@ -1794,17 +2904,7 @@ void serialSetup()
     //}
     default:
     {
-        gdraw.setColorDepth(8);
-        gdraw.createSprite(WIDTH, HEIGHT);
-        gdraw.fillSprite(TFT_BLACK);
-        gdraw.setFreeFont(FSS12);
-        gdraw.setTextDatum(MC_DATUM);
-        gdraw.setTextColor(TFT_RED);
-        gdraw.drawString("No Serial Stream Detected", 160, 120);
-        gdraw.setTextColor(TFT_WHITE);
-        gdraw.drawString("Is OnSpeed running?", 160, 160);
-        gdraw.pushSprite(0, 0);
-        gdraw.deleteSprite();
+        showScreen(SCREEN_NO_SERIAL);
         delay(3000);
         break;
     }
@@ -0,0 +1,99 @@
+/*
+  PanelScroll.h - the ST7789's hardware vertical scrolling, used as a horizontal strip chart.
+
+  The panel scrolls along its native 320 line axis, which setRotation(1) turns into the screen's
+  x axis.  VSCRDEF splits that axis into a fixed area on the left, the scroll area and a fixed
+  area on the right; VSCRSADD picks the frame memory column shown at the left edge of the
+  scroll area, wrapping round within it.  Moving that start by one column moves everything in
+  the scroll area across the screen without sending a pixel, and the column that wrapped
+  round to the left edge is the only one that has to be written again.
+
+  Frame memory is still addressed as before, so while scrolled a window at screen x has to be
+  written at memoryX(x), one column at a time where it may wrap.  FrameSprite knows nothing of
+  this: nothing may be pushed through it until end(), and its tiles have to be invalidated then.
+*/
+
+#ifndef _PANELSCROLL_H_
+#define _PANELSCROLL_H_
+
+#include <TFT_eSPI.h>
+
+#define ST7789_VSCRDEF 0x33
+#define ST7789_VSCRSADD 0x37
+#define PANEL_SCROLL_LINES 320 // native lines, the screen width in rotation 1
+
+class PanelScroll
+{
+public:
+    explicit PanelScroll(TFT_eSPI *tft) : _tft(tft), _left(0), _width(0), _offset(0), _active(false) {}
+
+    // scroll area from screen column left, width columns wide, at rest
+    void begin(uint16_t left, uint16_t width)
+    {
+        _left   = left;
+        _width  = width;
+        _offset = 0;
+        define(left, width);
+        start(left);
+        _active = true;
+    }
+
+    // the whole panel at rest again
+    void end()
+    {
+        if (!_active)
+            return;
+        define(0, PANEL_SCROLL_LINES);
+        start(0);
+        _active = false;
+    }
+
+    bool active()
+    {
+        return _active;
+    }
+
+    // move the scroll area's content one column to the right, the rightmost column comes back
+    // in on the left
+    void stepRight()
+    {
+        _offset = _offset ? _offset - 1 : _width - 1;
+        start(_left + _offset);
+    }
+
+    // frame memory column shown at screen column x
+    int32_t memoryX(int32_t x)
+    {
+        if (!_active || x < _left || x >= _left + _width)
+            return x;
+        return _left + (x - _left + _offset) % _width;
+    }
+
+private:
+    void define(uint16_t left, uint16_t width)
+    {
+        uint16_t right = PANEL_SCROLL_LINES - left - width;
+        _tft->writecommand(ST7789_VSCRDEF);
+        _tft->writedata(left >> 8);
+        _tft->writedata(left);
+        _tft->writedata(width >> 8);
+        _tft->writedata(width);
+        _tft->writedata(right >> 8);
+        _tft->writedata(right);
+    }
+
+    void start(uint16_t line)
+    {
+        _tft->writecommand(ST7789_VSCRSADD);
+        _tft->writedata(line >> 8);
+        _tft->writedata(line);
+    }
+
+    TFT_eSPI *_tft;
+    uint16_t  _left;
+    uint16_t  _width;
+    uint16_t  _offset; // memory column at the left of the scroll area, relative to it
+    bool      _active;
+};
+
+#endif // _PANELSCROLL_H_
@@ -0,0 +1,64 @@
+/*
+  PixelConvert.h - frame buffer lines to the panel's 16 bit pixels through a colour table.
+
+  The colour table holds the panel colour of every pixel value, already in SPI byte order.
+  Pixels are written two at a time with 32 bit stores: on the little endian ESP32 the first
+  of the two lands at the lower address and goes out first.  A 4 bit line goes through a
+  second table of 256 words, one per byte, holding both of its pixels, and is read a word at
+  a time, so eight pixels are one load, four lookups and four stores.
+
+  The output, and a 4 bit input, have to be 4 byte aligned, which FrameSprite's windows are:
+  they start on a tile and the line buffers come from the heap.
+
+  extras/host/PushConvertBench.cpp checks these against converting pixel by pixel and
+  measures their throughput.
+*/
+
+#ifndef _PIXELCONVERT_H_
+#define _PIXELCONVERT_H_
+
+#include <stdint.h>
+
+// 8 bit pixels, table of 256 entries
+inline void convertLine8(const uint8_t *in, uint32_t *out, const uint16_t *table, int32_t pixels)
+{
+    int32_t i = 0;
+    for (; i + 8 <= pixels; i += 8)
+    {
+        out[0] = table[in[i]] | ((uint32_t)table[in[i + 1]] << 16);
+        out[1] = table[in[i + 2]] | ((uint32_t)table[in[i + 3]] << 16);
+        out[2] = table[in[i + 4]] | ((uint32_t)table[in[i + 5]] << 16);
+        out[3] = table[in[i + 6]] | ((uint32_t)table[in[i + 7]] << 16);
+        out += 4;
+    }
+    for (; i + 2 <= pixels; i += 2)
+        *out++ = table[in[i]] | ((uint32_t)table[in[i + 1]] << 16);
+    if (i < pixels)
+        *(uint16_t *)out = table[in[i]];
+}
+
+// both pixels of every byte value, high nibble first, from a table of 16 colours
+inline void buildPairTable(const uint16_t *table, uint32_t *pairs)
+{
+    for (int i = 0; i < 256; i++)
+        pairs[i] = table[i >> 4] | ((uint32_t)table[i & 0x0F] << 16);
+}
+
+// 4 bit pixels, two to a byte, through buildPairTable()
+inline void convertLine4(const uint8_t *in, uint32_t *out, const uint32_t *pairs, int32_t bytes)
+{
+    int32_t i = 0;
+    for (; i + 4 <= bytes; i += 4)
+    {
+        uint32_t a = *(const uint32_t *)(in + i);
+        out[0]     = pairs[a & 0xFF];
+        out[1]     = pairs[(a >> 8) & 0xFF];
+        out[2]     = pairs[(a >> 16) & 0xFF];
+        out[3]     = pairs[a >> 24];
+        out += 4;
+    }
+    for (; i < bytes; i++)
+        *out++ = pairs[in[i]];
+}
+
+#endif // _PIXELCONVERT_H_
@@ -0,0 +1,73 @@
+/*
+  QualityGovernor.h - trades drawing detail for a steady frame rate.
+
+  Fed the render time of every frame, it keeps an average and compares it with a budget, the
+  render cost FrameScheduler allows at its shortest frame period.  After QUALITY_DOWN_FRAMES
+  frames over budget it lowers the quality level by one; after QUALITY_UP_FRAMES frames under
+  QUALITY_UP_PERCENT of the budget it raises it again.  The gap between the two thresholds and
+  the longer wait to go up keep it from stepping back and forth on a page that sits close to
+  the budget.  The pages decide what each level leaves out, level 0 is full detail.
+*/
+
+#ifndef _QUALITYGOVERNOR_H_
+#define _QUALITYGOVERNOR_H_
+
+#include <stdint.h>
+
+#define QUALITY_LEVELS 4
+#define QUALITY_COST_SHIFT 2      // render time average weight 1/4
+#define QUALITY_DOWN_FRAMES 5     // frames over budget before detail is dropped
+#define QUALITY_UP_FRAMES 60      // frames well under budget before detail comes back
+#define QUALITY_UP_PERCENT 60     // of the budget
+
+class QualityGovernor
+{
+public:
+    QualityGovernor(uint32_t budgetUs)
+        : level(0), budgetUs(budgetUs), avgUs(0), _over(0), _under(0)
+    {
+    }
+
+    // true if the level changed, the next frame is drawn at the new level
+    bool frame(uint32_t renderUs)
+    {
+        avgUs += ((int32_t)renderUs - (int32_t)avgUs) >> QUALITY_COST_SHIFT;
+
+        if (avgUs > budgetUs)
+        {
+            _under = 0;
+            if (++_over >= QUALITY_DOWN_FRAMES && level < QUALITY_LEVELS - 1)
+                return change(level + 1);
+        }
+        else if (avgUs < budgetUs * QUALITY_UP_PERCENT / 100)
+        {
+            _over = 0;
+            if (++_under >= QUALITY_UP_FRAMES && level > 0)
+                return change(level - 1);
+        }
+        else
+        {
+            _over  = 0;
+            _under = 0;
+        }
+        return false;
+    }
+
+    uint8_t  level;    // 0 full detail .. QUALITY_LEVELS - 1 least
+    uint32_t budgetUs;
+    uint32_t avgUs;    // average render time
+
+private:
+    bool change(uint8_t newLevel)
+    {
+        level  = newLevel;
+        _over  = 0;
+        _under = 0;
+        return true;
+    }
+
+    uint16_t _over;  // consecutive frames over budget
+    uint16_t _under; // consecutive frames well under budget
+};
+
+#endif // _QUALITYGOVERNOR_H_
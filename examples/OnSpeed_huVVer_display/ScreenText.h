@@ -0,0 +1,76 @@
+/*
+  ScreenText.h - the text of the screens shown outside the pages, while booting or upgrading.
+
+  The sketch draws each screen from this table on black, the splash straight to the panel
+  before the frame buffer is set up.
+*/
+
+#ifndef _SCREENTEXT_H_
+#define _SCREENTEXT_H_
+
+#include <stdint.h>
+
+enum ScreenFont
+{
+    SCREEN_FSS9,   // FreeSans9pt7b
+    SCREEN_FSS12,  // FreeSans12pt7b
+    SCREEN_FSSB12, // FreeSansBold12pt7b
+    SCREEN_FSSB24, // FreeSansBold24pt7b
+};
+
+enum ScreenId
+{
+    SCREEN_SPLASH,        // less the firmware version, which differs between builds
+    SCREEN_SERIAL_SEARCH, // looking for the serial port
+    SCREEN_NO_SERIAL,     // no serial port found
+    SCREEN_UPGRADING,     // firmware upload in progress
+    SCREEN_COUNT,
+};
+
+struct ScreenText
+{
+    const char *text;
+    uint8_t     font;  // ScreenFont
+    uint16_t    color; // on black
+    uint8_t     datum;
+    int16_t     x;
+    int16_t     y;
+};
+
+const ScreenText splashText[] = {
+    { "Fly OnSpeed", SCREEN_FSSB24, TFT_WHITE, MC_DATUM, 160, 60 },
+    { "To reset, hold Round button", SCREEN_FSS9, TFT_WHITE, MC_DATUM, 160, 200 },
+    { "To upgrade, reset & hold Square button", SCREEN_FSS9, TFT_WHITE, MC_DATUM, 160, 220 },
+};
+
+const ScreenText serialSearchText[] = {
+    { "Looking for Serial data", SCREEN_FSS12, TFT_WHITE, MC_DATUM, 160, 120 },
+    { "Please wait...", SCREEN_FSS12, TFT_WHITE, MC_DATUM, 160, 190 },
+};
+
+const ScreenText noSerialText[] = {
+    { "No Serial Stream Detected", SCREEN_FSS12, TFT_RED, MC_DATUM, 160, 120 },
+    { "Is OnSpeed running?", SCREEN_FSS12, TFT_WHITE, MC_DATUM, 160, 160 },
+};
+
+const ScreenText upgradingText[] = {
+    { "Upgrading Firmware", SCREEN_FSSB12, TFT_WHITE, MC_DATUM, 160, 90 },
+    { "Please wait...", SCREEN_FSS12, TFT_WHITE, MC_DATUM, 160, 150 },
+};
+
+struct StaticScreen
+{
+    const ScreenText *texts;
+    uint8_t           count;
+};
+
+#define SCREEN_TEXTS(t) { t, sizeof(t) / sizeof(t[0]) }
+
+const StaticScreen staticScreens[SCREEN_COUNT] = {
+    SCREEN_TEXTS(splashText),
+    SCREEN_TEXTS(serialSearchText),
+    SCREEN_TEXTS(noSerialText),
+    SCREEN_TEXTS(upgradingText),
+};
+
+#endif // _SCREENTEXT_H_
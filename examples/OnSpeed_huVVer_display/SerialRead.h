@@ -37,6 +37,9 @@ extern const float aoaSmoothingAlpha;    // 1 = max smoothing, 0.01 no smoothing
 extern const float slipSmoothingAlpha;   // 1 = max smoothing, 0.01 no smoothing.
 extern const float decelSmoothingAlpha;  // 1 = max smoothing, 0.01 no smoothing.
 extern uint64_t serialMillis;
+extern FrameInterp frameInterp;
+extern EnergyRate energyRate;
+extern FrameScheduler frameScheduler;
 extern const float serialRate;
 void SerialProcess();
 
@@ -232,6 +235,16 @@ void SerialProcess()
     DecelRate          =- iasDerivative.Compute();
     DecelRate          =  DecelRate/serialRate;
     SmoothedDecelRate  =  DecelRate * decelSmoothingAlpha + SmoothedDecelRate * (1-decelSmoothingAlpha);
+
+    // specific excess power, incremental fixed point
+    energyRate.update(IAS, iVSI, Palt, OAT);
+
+    // timestamp the frame for render-rate interpolation
+    FrameSample frame  =  { SmoothedAOA, (float)Slip, Pitch, Roll, FlightPath };
+    frameInterp.push(millis(), frame);
+
+    // new data to show
+    frameScheduler.dataArrived(micros());
 } // end SerialProcess()
 
 
@@ -0,0 +1,132 @@
+/*
+  StripChart.h - a scrolling plot of one channel, kept between frames.
+
+  The plot is a thick line through the samples, one column per sample, newest on the left.
+  Each column is retained as the vertical run the line covers there: from the previous
+  sample's line to this one's, widened by the line's thickness above and below, so
+  neighbouring columns always overlap and the line stays connected however steep it is.
+  add() shifts the columns one place with a memmove and works out only the newest run;
+  draw() then costs one drawFastVLine per column, where plotting every sample again took a
+  fillCircle each.
+
+      StripChart chart(20, 300, 160, 26.67, 0, 239, 2);
+      chart.allocate();
+      chart.add(VerticalG, TFT_GREEN);   // per sample
+      chart.draw(gdraw);                 // per frame
+
+  The columns come from the heap, allocate() once before it gets fragmented; draw() returns
+  false without them, and the caller has to plot the samples itself.  Lines are kept in a
+  byte, so the plot has to lie in the first 256 lines.
+*/
+
+#ifndef _STRIPCHART_H_
+#define _STRIPCHART_H_
+
+#include <stdlib.h>
+#include <string.h>
+#include <TFT_eSPI.h>
+
+struct StripColumn
+{
+    uint8_t  top;    // first line of the run
+    uint8_t  bottom; // last line
+    uint16_t color;
+};
+
+class StripChart
+{
+public:
+    // width columns from screen column left; value 0 at line zeroY, linesPerUnit lines per unit
+    // upwards, clipped to lines top to bottom
+    StripChart(int16_t left, int16_t width, int16_t zeroY, float linesPerUnit, int16_t top, int16_t bottom,
+               uint8_t thickness)
+        : _columns(NULL), _left(left), _width(width), _zeroY(zeroY), _linesPerUnit(linesPerUnit), _top(top),
+          _bottom(bottom), _thickness(thickness), _count(0), _lastY(zeroY)
+    {
+    }
+
+    bool allocate()
+    {
+        if (_columns == NULL)
+            _columns = (StripColumn *)malloc(_width * sizeof(StripColumn));
+        return _columns != NULL;
+    }
+
+    uint32_t bytes()
+    {
+        return _width * sizeof(StripColumn);
+    }
+
+    // every column at the same value, as if it had been sampled for the whole width
+    void fill(float value, uint16_t color)
+    {
+        _count = 0;
+        add(value, color);
+        for (int16_t i = 1; i < _width && _columns != NULL; i++)
+            _columns[i] = _columns[0];
+        _count = _columns != NULL ? _width : 0;
+    }
+
+    // the newest sample, the oldest column drops off the right
+    void add(float value, uint16_t color)
+    {
+        int16_t y    = line(value);
+        int16_t from = _count ? _lastY : y;
+        _lastY       = y;
+        if (_columns == NULL)
+            return;
+
+        int16_t top    = (from < y ? from : y) - _thickness;
+        int16_t bottom = (from > y ? from : y) + _thickness;
+        memmove(_columns + 1, _columns, (_width - 1) * sizeof(StripColumn));
+        _columns[0].top    = top < _top ? _top : top;
+        _columns[0].bottom = bottom > _bottom ? _bottom : bottom;
+        _columns[0].color  = color;
+        if (_count < _width)
+            _count++;
+    }
+
+    // the whole plot, false if the columns could not be allocated
+    bool draw(TFT_eSPI &out)
+    {
+        if (_columns == NULL)
+            return false;
+        for (int16_t i = 0; i < _count; i++)
+            drawColumn(out, i, _left + i);
+        return true;
+    }
+
+    // column i, 0 the newest, at screen column x
+    void drawColumn(TFT_eSPI &out, int16_t i, int32_t x)
+    {
+        if (_columns == NULL || i >= _count)
+            return;
+        const StripColumn &c = _columns[i];
+        out.drawFastVLine(x, c.top, c.bottom - c.top + 1, c.color);
+    }
+
+    int16_t columns()
+    {
+        return _count;
+    }
+
+private:
+    int16_t line(float value)
+    {
+        int y = _zeroY - int(value * _linesPerUnit);
+        return y < _top ? _top : y > _bottom ? _bottom : y;
+    }
+
+    StripColumn *_columns;
+    int16_t      _left;
+    int16_t      _width;
+    int16_t      _zeroY;
+    float        _linesPerUnit;
+    int16_t      _top;
+    int16_t      _bottom;
+    uint8_t      _thickness; // lines added above and below the run
+    int16_t      _count;     // columns sampled so far
+    int16_t      _lastY;     // line of the newest sample
+};
+
+#endif // _STRIPCHART_H_
@@ -0,0 +1,155 @@
+/*
+  Symbol.h - a fixed shape drawn once at setup and blitted wherever a frame needs it.
+
+  The shape's drawing function is run once into a small 16 bit sprite cleared to a colour key
+  (TFT_TRANSPARENT), a band of SYMBOL_BAND_LINES lines at a time so that large symbols need no
+  large buffer, and every line is kept as its runs of one colour, key pixels left out.
+  draw() then puts the runs back with one drawFastHLine each, which FrameSprite clips,
+  records and damage tracks like any other draw; the lines, circles and triangles of the
+  shape are not worked out again.  The pixels are the ones the drawing function would give
+  at the same place, as long as it draws nothing in the key colour.
+
+      void drawMarker(TFT_eSPI &out, int16_t x, int16_t y);   // the shape, anchored at x, y
+
+      Symbol marker("marker", drawMarker, -35, -35, 71, 71);  // box around the anchor
+      marker.rasterize(&tft);                                  // once, at setup
+      marker.draw(gdraw, fpX, fpY);                            // per frame
+
+  Without runs, not rasterized or out of heap, draw() calls the drawing function instead.
+*/
+
+#ifndef _SYMBOL_H_
+#define _SYMBOL_H_
+
+#include <stdlib.h>
+#include <TFT_eSPI.h>
+
+#define SYMBOL_BAND_LINES 16
+#define SYMBOL_KEY TFT_TRANSPARENT
+
+typedef void (*SymbolDraw)(TFT_eSPI &out, int16_t x, int16_t y);
+
+struct SymbolRun
+{
+    int16_t  x; // from the anchor
+    int16_t  y;
+    int16_t  w;
+    uint16_t color;
+};
+
+class Symbol
+{
+public:
+    Symbol(const char *name, SymbolDraw drawFn, int16_t left, int16_t top, int16_t width, int16_t height)
+        : name(name), draws(0), drawUs(0), _drawFn(drawFn), _left(left), _top(top), _width(width),
+          _height(height), _runs(NULL), _count(0)
+    {
+    }
+
+    // the shape into runs, once; false without the heap for the band or the runs
+    bool rasterize(TFT_eSPI *tft)
+    {
+        if (_runs != NULL)
+            return true;
+
+        TFT_eSprite band(tft);
+        band.setColorDepth(16);
+        if (band.createSprite(_width, SYMBOL_BAND_LINES) == NULL)
+            return false;
+
+        // count the runs first, then store them
+        for (int pass = 0; pass < 2; pass++)
+        {
+            uint16_t count = 0;
+            for (int16_t bandTop = 0; bandTop < _height; bandTop += SYMBOL_BAND_LINES)
+            {
+                band.fillSprite(SYMBOL_KEY);
+                _drawFn(band, -_left, -_top - bandTop);
+
+                int16_t lines = _height - bandTop < SYMBOL_BAND_LINES ? _height - bandTop : SYMBOL_BAND_LINES;
+                for (int16_t y = 0; y < lines; y++)
+                {
+                    int16_t x = 0;
+                    while (x < _width)
+                    {
+                        uint16_t color = band.readPixel(x, y);
+                        int16_t  start = x;
+                        while (++x < _width && band.readPixel(x, y) == color)
+                            ;
+                        if (color == SYMBOL_KEY)
+                            continue;
+                        if (_runs != NULL)
+                        {
+                            SymbolRun &run = _runs[count];
+                            run.x          = _left + start;
+                            run.y          = _top + bandTop + y;
+                            run.w          = x - start;
+                            run.color      = color;
+                        }
+                        count++;
+                    }
+                }
+            }
+
+            if (pass == 0)
+            {
+                _runs = (SymbolRun *)malloc(count * sizeof(SymbolRun));
+                if (_runs == NULL)
+                    break;
+            }
+            _count = count;
+        }
+
+        band.deleteSprite();
+        return _runs != NULL;
+    }
+
+    // the symbol with its anchor at x, y
+    void draw(TFT_eSPI &out, int16_t x, int16_t y)
+    {
+        uint32_t start = micros();
+        if (_runs == NULL)
+            _drawFn(out, x, y);
+        else
+            for (uint16_t i = 0; i < _count; i++)
+                out.drawFastHLine(x + _runs[i].x, y + _runs[i].y, _runs[i].w, _runs[i].color);
+        draws++;
+        drawUs += micros() - start;
+    }
+
+    SymbolDraw drawFn()
+    {
+        return _drawFn;
+    }
+
+    uint16_t runs()
+    {
+        return _runs != NULL ? _count : 0;
+    }
+
+    uint32_t bytes()
+    {
+        return runs() * sizeof(SymbolRun);
+    }
+
+    void clearStats()
+    {
+        draws  = 0;
+        drawUs = 0;
+    }
+
+    const char *name;
+    uint32_t    draws;  // since clearStats()
+    uint32_t    drawUs; // total time drawing
+
+private:
+    SymbolDraw _drawFn;
+    int16_t    _left; // box around the anchor the drawing function stays in
+    int16_t    _top;
+    int16_t    _width;
+    int16_t    _height;
+    SymbolRun *_runs;
+    uint16_t   _count;
+};
+
+#endif // _SYMBOL_H_
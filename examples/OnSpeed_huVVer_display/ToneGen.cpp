@@ -0,0 +1,240 @@
+/*
+  ToneGen.cpp - OnSpeed AOA tone synthesis for the huVVer-AVI DAC outputs.
+*/
+
+#include "ToneGen.h"
+#include <math.h>
+
+#define SINE_TABLE_BITS 8
+#define SINE_TABLE_SIZE (1 << SINE_TABLE_BITS)
+
+static int16_t sineTable[SINE_TABLE_SIZE];
+static bool sineTableReady = false;
+
+static void buildSineTable()
+{
+    for (int i = 0; i < SINE_TABLE_SIZE; i++)
+        sineTable[i] = (int16_t)lroundf(TONE_AMPLITUDE * sinf(2.0f * (float)M_PI * i / SINE_TABLE_SIZE));
+    sineTableReady = true;
+}
+
+// phase accumulator step for a given rate, full circle = 2^32
+static uint32_t phaseStep(float hz)
+{
+    return (uint32_t)(hz * (4294967296.0f / TONE_SAMPLE_RATE));
+}
+
+// -----------------------------------------------
+
+ToneSynth::ToneSynth()
+{
+    if (!sineTableReady)
+        buildSineTable();
+
+    _phase         = 0;
+    _pulsePhase    = 0;
+    _envelope      = 0;
+    mute();
+}
+
+// -----------------------------------------------
+
+void ToneSynth::mute()
+{
+    toneFrequency = 0;
+    pulseRate     = 0;
+    _phaseStep    = 0;
+    _pulseStep    = 0;
+}
+
+// -----------------------------------------------
+
+// Select tone and pulse rate from AOA, same mapping as the OnSpeed box.
+
+void ToneSynth::setAOA(float aoa, float ias, float tonesOnAOA, float fastAOA, float slowAOA, float stallWarnAOA)
+{
+    uint16_t frequency;
+    float    rate;
+
+    if (ias < TONE_MUTE_IAS || aoa <= tonesOnAOA)
+    {
+        mute();
+        return;
+    }
+
+    if (aoa >= stallWarnAOA)
+    {
+        frequency = TONE_HIGH_HZ;
+        rate      = TONE_STALL_PPS;
+    }
+    else if (aoa > slowAOA)
+    {
+        frequency = TONE_HIGH_HZ;
+        rate      = TONE_HIGH_PPS_MIN + (aoa - slowAOA) * (TONE_HIGH_PPS_MAX - TONE_HIGH_PPS_MIN) / (stallWarnAOA - slowAOA);
+    }
+    else if (aoa >= fastAOA)
+    {
+        frequency = TONE_LOW_HZ;
+        rate      = 0; // solid tone onspeed
+    }
+    else
+    {
+        frequency = TONE_LOW_HZ;
+        rate      = TONE_LOW_PPS_MIN + (aoa - tonesOnAOA) * (TONE_LOW_PPS_MAX - TONE_LOW_PPS_MIN) / (fastAOA - tonesOnAOA);
+    }
+
+    toneFrequency = frequency;
+    pulseRate     = rate;
+    _phaseStep    = phaseStep(frequency);
+    _pulseStep    = phaseStep(rate);
+}
+
+// -----------------------------------------------
+
+// Phase continuous tone, gated by the pulse phase with a linear ramp on each edge.
+
+void ToneSynth::render(int16_t *buffer, uint16_t count)
+{
+    for (uint16_t i = 0; i < count; i++)
+    {
+        bool gate = _phaseStep != 0 && (_pulseStep == 0 || _pulsePhase < 0x80000000UL);
+
+        if (gate)
+        {
+            if (_envelope < TONE_RAMP_SAMPLES)
+                _envelope++;
+        }
+        else if (_envelope > 0)
+            _envelope--;
+
+        if (_envelope > 0)
+        {
+            buffer[i] = (int16_t)((sineTable[_phase >> (32 - SINE_TABLE_BITS)] * _envelope) / TONE_RAMP_SAMPLES);
+            _phase   += _phaseStep;
+        }
+        else
+        {
+            buffer[i] = 0;
+            _phase    = 0; // start each pulse on a zero crossing
+        }
+
+        _pulsePhase += _pulseStep;
+    }
+
+    if (_pulseStep == 0)
+        _pulsePhase = 0; // restart pulsing with the tone on
+}
+
+// -----------------------------------------------
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+#include <Arduino.h>
+#include <driver/i2s.h>
+
+static ToneSynth   *toneSynth      = NULL; // allocated by toneBegin(), nothing is linked in unless tones are used
+static TaskHandle_t toneTaskHandle = NULL;
+static portMUX_TYPE toneMux        = portMUX_INITIALIZER_UNLOCKED;
+
+static struct
+{
+    bool  muted;
+    float aoa, ias, tonesOnAOA, fastAOA, slowAOA, stallWarnAOA;
+} toneInput = { true, 0, 0, 0, 0, 0, 0 };
+
+// Runs on core 0, paced by i2s_write() blocking until a DMA buffer is free.
+
+static void toneTask(void *parameter)
+{
+    static int16_t  samples[TONE_BUFFER_LEN];
+    static uint16_t frames[TONE_BUFFER_LEN * 2]; // left/right pairs for both DAC channels
+    size_t written;
+
+    for (;;)
+    {
+        portENTER_CRITICAL(&toneMux);
+        bool  muted        = toneInput.muted;
+        float aoa          = toneInput.aoa;
+        float ias          = toneInput.ias;
+        float tonesOnAOA   = toneInput.tonesOnAOA;
+        float fastAOA      = toneInput.fastAOA;
+        float slowAOA      = toneInput.slowAOA;
+        float stallWarnAOA = toneInput.stallWarnAOA;
+        portEXIT_CRITICAL(&toneMux);
+
+        if (muted)
+            toneSynth->mute();
+        else
+            toneSynth->setAOA(aoa, ias, tonesOnAOA, fastAOA, slowAOA, stallWarnAOA);
+
+        toneSynth->render(samples, TONE_BUFFER_LEN);
+
+        // the built-in DAC takes unsigned 8 bit samples from the high byte
+        for (int i = 0; i < TONE_BUFFER_LEN; i++)
+        {
+            uint16_t sample   = (uint16_t)(samples[i] + 32768) & 0xFF00;
+            frames[2 * i]     = sample;
+            frames[2 * i + 1] = sample;
+        }
+
+        i2s_write(I2S_NUM_0, frames, sizeof(frames), &written, portMAX_DELAY);
+    }
+}
+
+// -----------------------------------------------
+
+void toneBegin()
+{
+    if (toneTaskHandle != NULL)
+        return;
+
+    toneSynth = new ToneSynth();
+
+    i2s_config_t i2sConfig;
+    memset(&i2sConfig, 0, sizeof(i2sConfig));
+    i2sConfig.mode                 = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX | I2S_MODE_DAC_BUILT_IN);
+    i2sConfig.sample_rate          = TONE_SAMPLE_RATE;
+    i2sConfig.bits_per_sample      = I2S_BITS_PER_SAMPLE_16BIT;
+    i2sConfig.channel_format       = I2S_CHANNEL_FMT_RIGHT_LEFT;
+    i2sConfig.communication_format = I2S_COMM_FORMAT_STAND_MSB;
+    i2sConfig.dma_buf_count        = 2;
+    i2sConfig.dma_buf_len          = TONE_BUFFER_LEN;
+    i2sConfig.use_apll             = false;
+    i2sConfig.tx_desc_auto_clear   = true; // output silence if the task ever falls behind
+
+    if (i2s_driver_install(I2S_NUM_0, &i2sConfig, 0, NULL) != ESP_OK)
+    {
+        Serial.println("Tone generator: I2S driver install failed");
+        return;
+    }
+    i2s_set_pin(I2S_NUM_0, NULL);                    // built-in DAC on GPIO25/GPIO26
+    i2s_set_dac_mode(I2S_DAC_CHANNEL_BOTH_EN);
+
+    xTaskCreatePinnedToCore(toneTask, "toneTask", 2048, NULL, configMAX_PRIORITIES - 2, &toneTaskHandle, 0);
+}
+
+// -----------------------------------------------
+
+void toneUpdate(float aoa, float ias, float tonesOnAOA, float fastAOA, float slowAOA, float stallWarnAOA)
+{
+    portENTER_CRITICAL(&toneMux);
+    toneInput.muted        = false;
+    toneInput.aoa          = aoa;
+    toneInput.ias          = ias;
+    toneInput.tonesOnAOA   = tonesOnAOA;
+    toneInput.fastAOA      = fastAOA;
+    toneInput.slowAOA      = slowAOA;
+    toneInput.stallWarnAOA = stallWarnAOA;
+    portEXIT_CRITICAL(&toneMux);
+}
+
+// -----------------------------------------------
+
+void toneMute()
+{
+    portENTER_CRITICAL(&toneMux);
+    toneInput.muted = true;
+    portEXIT_CRITICAL(&toneMux);
+}
+
+#endif // ARDUINO_ARCH_ESP32
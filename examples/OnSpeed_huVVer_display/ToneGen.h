@@ -0,0 +1,64 @@
+/*
+  ToneGen.h - OnSpeed AOA tone synthesis for the huVVer-AVI DAC outputs.
+
+  Provides a local backup of the OnSpeed audio cues:
+    - below L/Dmax (tones on AOA)        : silence
+    - L/Dmax to onspeed fast             : low tone, pulse rate rising with AOA
+    - onspeed fast to onspeed slow       : low tone, solid
+    - onspeed slow to stall warning      : high tone, pulse rate rising with AOA
+    - at or above stall warning          : high tone, 20 pulses per second
+
+  ToneSynth is plain C++ so it can be built on a desktop to render recorded flights
+  to WAV files (see extras/host/ToneGenWav.cpp).  On the ESP32 the samples are streamed
+  to the built-in DAC (PIN_AUDL/PIN_AUDR) through I2S DMA from a small double buffer,
+  filled by a task on core 0, so audio timing never depends on the display loop.
+
+  Note: the SPI clock couples into the right audio channel at 40 MHz, see my_custom_setup.h.
+*/
+
+#ifndef _TONEGEN_H_
+#define _TONEGEN_H_
+
+#include <stdint.h>
+
+#define TONE_SAMPLE_RATE 16000 // Hz
+#define TONE_BUFFER_LEN 256    // samples per DMA buffer, 16 ms at 16 kHz
+#define TONE_LOW_HZ 400        // OnSpeed low tone
+#define TONE_HIGH_HZ 1600      // OnSpeed high tone
+#define TONE_LOW_PPS_MIN 1.5f  // pulses per second at L/Dmax
+#define TONE_LOW_PPS_MAX 8.2f  // pulses per second approaching onspeed fast
+#define TONE_HIGH_PPS_MIN 1.5f // pulses per second at onspeed slow
+#define TONE_HIGH_PPS_MAX 6.2f // pulses per second approaching stall warning
+#define TONE_STALL_PPS 20.0f   // stall warning pulse rate
+#define TONE_MUTE_IAS 25.0f    // no tones below this airspeed (kts), i.e. on the ground
+#define TONE_RAMP_SAMPLES 64   // 4 ms attack/decay on every pulse edge to avoid clicks
+#define TONE_AMPLITUDE 16000   // peak sample value, about half of full scale
+
+class ToneSynth
+{
+public:
+    ToneSynth();
+
+    void setAOA(float aoa, float ias, float tonesOnAOA, float fastAOA, float slowAOA, float stallWarnAOA);
+    void mute();
+    void render(int16_t *buffer, uint16_t count); // fill count mono samples
+
+    uint16_t toneFrequency; // 0 = silent
+    float pulseRate;        // pulses per second, 0 = solid tone
+
+private:
+    uint32_t _phase;      // tone phase accumulator, full circle = 2^32
+    uint32_t _phaseStep;
+    uint32_t _pulsePhase; // pulse phase accumulator, tone is on for the first half
+    uint32_t _pulseStep;
+    int32_t _envelope;    // 0..TONE_RAMP_SAMPLES
+};
+
+#if defined(ARDUINO_ARCH_ESP32)
+void toneBegin();                                          // start the I2S DAC and the tone task
+void toneUpdate(float aoa, float ias, float tonesOnAOA,    // new AOA and setpoints from the serial stream
+                float fastAOA, float slowAOA, float stallWarnAOA);
+void toneMute();                                           // silence, e.g. on serial data loss
+#endif
+
+#endif // _TONEGEN_H_
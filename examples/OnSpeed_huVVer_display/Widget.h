@@ -0,0 +1,145 @@
+/*
+  Widget.h - a region of a page drawn only when its own inputs change.
+
+  A page is still rendered as one frame, but a widget's part of it comes from a cache of its
+  recorded draws (FrameSprite::beginCapture()) unless its key, a hash of the values it is
+  drawn from, has changed or its refresh period has run out.  Replaying the cached draws
+  skips the fonts, trigonometry and triangle filling, and as the pixels are the same the
+  tile checksums keep the region from being pushed again.
+
+      if (iasWidget.begin(frameSprite, WidgetKey().add(int(displayIAS)).value))
+      {
+          ... draw the widget ...
+          iasWidget.end(frameSprite);
+      }
+
+  The cache holds display list commands, so widgets are only cached while FrameSprite is
+  recording (beginBands() or beginStrips()); otherwise begin() always returns true.  A widget
+  drawing more than its cache holds is drawn every frame, and every cache has to be
+  invalidated when the page or its palette changes.
+*/
+
+#ifndef _WIDGET_H_
+#define _WIDGET_H_
+
+#include <stdlib.h>
+#include "FrameSprite.h"
+
+// FNV-1a over the values a widget is drawn from
+struct WidgetKey
+{
+    WidgetKey() : value(2166136261UL) {}
+
+    WidgetKey &add(uint32_t v)
+    {
+        value = (value ^ v) * 16777619UL;
+        return *this;
+    }
+
+    // a readout as the string drawn
+    WidgetKey &addText(const char *text)
+    {
+        while (*text)
+            add(*text++);
+        return *this;
+    }
+
+    uint32_t value;
+};
+
+class Widget
+{
+public:
+    Widget(const char *name, uint16_t cacheBytes, uint32_t refreshMs)
+        : name(name), renders(0), replays(0), renderUs(0), replayUs(0), overflows(0), _cache(NULL), _size(cacheBytes),
+          _bytes(0), _refreshMs(refreshMs), _key(0), _drawnMs(0), _cached(false), _capturing(false), _start(0)
+    {
+    }
+
+    // allocate the cache, once, before the heap gets fragmented
+    bool allocate()
+    {
+        if (_cache == NULL)
+            _cache = (uint8_t *)malloc(_size);
+        return _cache != NULL;
+    }
+
+    void invalidate()
+    {
+        _cached = false;
+    }
+
+    // true if the widget has to be drawn and end() called; false if its cached draws were used
+    bool begin(FrameSprite &sprite, uint32_t key)
+    {
+        uint32_t nowMs = millis();
+        _start         = micros();
+
+        if (_cached && key == _key && (_refreshMs == 0 || nowMs - _drawnMs < _refreshMs))
+        {
+            sprite.replay(_cache, _bytes);
+            replays++;
+            replayUs += micros() - _start;
+            return false;
+        }
+
+        _key       = key;
+        _drawnMs   = nowMs;
+        _cached    = false;
+        _capturing = _cache != NULL && sprite.beginCapture();
+        return true;
+    }
+
+    void end(FrameSprite &sprite)
+    {
+        if (_capturing)
+        {
+            _cached = sprite.endCapture(_cache, _size, _bytes);
+            if (!_cached && _bytes > _size)
+                overflows++;
+            _capturing = false;
+        }
+        renders++;
+        renderUs += micros() - _start;
+    }
+
+    uint16_t cacheSize()
+    {
+        return _size;
+    }
+
+    // bytes of display list the widget drew the last time it was captured
+    uint32_t drawBytes()
+    {
+        return _bytes;
+    }
+
+    void clearStats()
+    {
+        renders   = 0;
+        replays   = 0;
+        renderUs  = 0;
+        replayUs  = 0;
+        overflows = 0;
+    }
+
+    const char *name;
+    uint32_t    renders;   // times drawn since clearStats()
+    uint32_t    replays;   // times replayed from the cache
+    uint32_t    renderUs;  // total time drawing
+    uint32_t    replayUs;  // total time replaying
+    uint32_t    overflows; // draws that did not fit the cache
+
+private:
+    uint8_t *_cache;
+    uint16_t _size;
+    uint32_t _bytes;     // cached draws
+    uint32_t _refreshMs; // drawn again at least this often, 0 for only when the key changes
+    uint32_t _key;
+    uint32_t _drawnMs;
+    bool     _cached;
+    bool     _capturing;
+    uint32_t _start;
+};
+
+#endif // _WIDGET_H_
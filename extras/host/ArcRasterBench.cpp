@@ -0,0 +1,297 @@
+/*
+  ArcRasterBench.cpp - correctness and fill time of the scanline arcs (ArcRaster.h) against the
+  triangle tessellation Gauges::fillArc() used before.
+
+  The triangles are drawn as TFT_eSPI's fillTriangle() draws them, with the vertices worked
+  out exactly as the old fillArc() did at ARCSTEP.  For a sweep of radii, widths, start angles
+  and sweeps, clockwise and counterclockwise, every pixel one way fills and the other does
+  not must have a pixel of the other's fill next to it, i.e. the two agree within one
+  pixel; an arc with a pixel further off fails.  The triangles ran counterclockwise arcs up
+  to one step early at either end, so those are compared with the clockwise triangles over
+  the same part of the ring.  Sectors split at random angles are checked to cover exactly the
+  whole sector's pixels.  Then the two onspeed arcs of drawAOA() and the six ranges of a five
+  range arcGraph() are timed both ways.  The speedups vary with the host and its load, runs
+  have given 12x to 28x for drawAOA() and 4x to 7x for arcGraph().  The ESP32 is not timed.
+
+  Build (from this directory):
+    g++ -O2 -std=gnu++11 -I../.. -o ArcRasterBench ArcRasterBench.cpp
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "ArcRaster.h"
+
+#define WIDTH 320
+#define HEIGHT 240
+#define ARCSTEP 0.01745329252f // GaugeWidgets.cpp
+#define DEG_TO_RAD_F 0.01745329252f
+
+struct HostFrame
+{
+    std::vector<uint8_t> pixels;
+
+    HostFrame() : pixels(WIDTH * HEIGHT, 0) {}
+
+    void clear()
+    {
+        memset(&pixels[0], 0, pixels.size());
+    }
+
+    // adds, so that pixels drawn twice show
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+    {
+        if (y < 0 || y >= HEIGHT)
+            return;
+        if (x < 0)
+        {
+            w += x;
+            x = 0;
+        }
+        if (x + w > WIDTH)
+            w = WIDTH - x;
+        for (int32_t i = 0; i < w; i++)
+            pixels[y * WIDTH + x + i] += color;
+    }
+
+    // TFT_eSPI::fillTriangle()
+    void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color)
+    {
+        int32_t a, b, y, last, t;
+#define SWAP(p, q) (t = p, p = q, q = t)
+        if (y0 > y1) { SWAP(y0, y1); SWAP(x0, x1); }
+        if (y1 > y2) { SWAP(y2, y1); SWAP(x2, x1); }
+        if (y0 > y1) { SWAP(y0, y1); SWAP(x0, x1); }
+        if (y0 == y2)
+        {
+            a = b = x0;
+            if (x1 < a) a = x1; else if (x1 > b) b = x1;
+            if (x2 < a) a = x2; else if (x2 > b) b = x2;
+            span(a, y0, b - a + 1, color);
+            return;
+        }
+        int32_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+        int32_t sa = 0, sb = 0;
+        last = y1 == y2 ? y1 : y1 - 1;
+        for (y = y0; y <= last; y++)
+        {
+            a = x0 + sa / dy01;
+            b = x0 + sb / dy02;
+            sa += dx01;
+            sb += dx02;
+            if (a > b) SWAP(a, b);
+            span(a, y, b - a + 1, color);
+        }
+        sa = dx12 * (y - y1);
+        sb = dx02 * (y - y0);
+        for (; y <= y2; y++)
+        {
+            a = x1 + sa / dy12;
+            b = x0 + sb / dy02;
+            sa += dx12;
+            sb += dx02;
+            if (a > b) SWAP(a, b);
+            span(a, y, b - a + 1, color);
+        }
+#undef SWAP
+    }
+
+    // overwrites, the triangles overlap
+    void span(int32_t x, int32_t y, int32_t w, uint32_t color)
+    {
+        if (y < 0 || y >= HEIGHT)
+            return;
+        for (int32_t i = x < 0 ? -x : 0; i < w && x + i < WIDTH; i++)
+            pixels[y * WIDTH + x + i] = color;
+    }
+};
+
+// the fill of Gauges::fillArc() before ArcRaster.h, counterclockwise arcs one step late
+static void fillArcTriangles(HostFrame &out, int16_t x0, int16_t y0, int16_t radius, float startAngle, float arcAngle,
+                             uint16_t lineWidth, uint8_t color)
+{
+    for (float j = 0; j < fabsf(arcAngle); j += ARCSTEP)
+    {
+        float theta = startAngle + j;
+        float step  = (fabsf(arcAngle) - j < ARCSTEP) ? fabsf(arcAngle) - j : ARCSTEP;
+        float cosA, sinA, cosB, sinB;
+        if (arcAngle >= 0)
+        {
+            cosA = cos(theta);
+            sinA = sin(theta);
+            cosB = cos(theta + step);
+            sinB = sin(theta + step);
+        }
+        else
+        {
+            cosA = -cos(theta);
+            sinA = sin(theta);
+            cosB = -cos(theta - step);
+            sinB = sin(theta - step);
+        }
+        int16_t LW2 = lineWidth / 2;
+        int16_t x1  = x0 + (radius + LW2) * cosA;
+        int16_t y1  = y0 + (radius + LW2) * sinA;
+        int16_t x2  = x0 + (radius - LW2) * cosA;
+        int16_t y2  = y0 + (radius - LW2) * sinA;
+        int16_t x3  = x0 + (radius + LW2) * cosB;
+        int16_t y3  = y0 + (radius + LW2) * sinB;
+        int16_t x4  = x0 + (radius - LW2) * cosB;
+        int16_t y4  = y0 + (radius - LW2) * sinB;
+        out.fillTriangle(x1, y1, x2, y2, x3, y3, color);
+        out.fillTriangle(x3, y3, x2, y2, x4, y4, color);
+    }
+}
+
+// the fill of Gauges::fillArc() now
+static void fillArcScanline(HostFrame &out, int16_t x0, int16_t y0, int16_t radius, float startAngle, float arcAngle,
+                            uint16_t lineWidth, uint8_t color)
+{
+    float   from = arcAngle >= 0 ? startAngle : (float)M_PI - startAngle + arcAngle;
+    int16_t LW2  = lineWidth / 2;
+    fillArcSector(out, x0, y0, radius - LW2, radius + LW2, from, fabsf(arcAngle), color);
+}
+
+// pixels of a not within reach pixels of b
+static int strays(const HostFrame &a, const HostFrame &b, int reach)
+{
+    int count = 0;
+    for (int y = 0; y < HEIGHT; y++)
+        for (int x = 0; x < WIDTH; x++)
+        {
+            if (!a.pixels[y * WIDTH + x] || b.pixels[y * WIDTH + x])
+                continue;
+            bool near = false;
+            for (int dy = -reach; dy <= reach && !near; dy++)
+                for (int dx = -reach; dx <= reach && !near; dx++)
+                {
+                    int nx = x + dx, ny = y + dy;
+                    near = nx >= 0 && nx < WIDTH && ny >= 0 && ny < HEIGHT && b.pixels[ny * WIDTH + nx];
+                }
+            count += !near;
+        }
+    return count;
+}
+
+static bool checkMatch()
+{
+    HostFrame triangles, scanline;
+    int       cases = 0, failed = 0, differ = 0, total = 0;
+    for (int radius = 16; radius <= 116; radius += 25)
+        for (int width = 2; width <= 16; width += 7)
+            for (int start = -180; start < 360; start += 37)
+                for (int sweep = 5; sweep <= 360; sweep += 71)
+                    for (int dir = 1; dir >= -1; dir -= 2)
+                    {
+                        triangles.clear();
+                        scanline.clear();
+                        // counterclockwise arcs as the clockwise triangles of the same ring
+                        float from = dir > 0 ? start * DEG_TO_RAD_F : (float)M_PI - (start + sweep) * DEG_TO_RAD_F;
+                        fillArcTriangles(triangles, 160, 120, radius, from, sweep * DEG_TO_RAD_F, width, 1);
+                        fillArcScanline(scanline, 160, 120, radius, start * DEG_TO_RAD_F, dir * sweep * DEG_TO_RAD_F,
+                                        width, 1);
+                        int off = strays(triangles, scanline, 1) + strays(scanline, triangles, 1);
+                        for (size_t i = 0; i < scanline.pixels.size(); i++)
+                        {
+                            differ += scanline.pixels[i] != triangles.pixels[i];
+                            total += triangles.pixels[i] != 0;
+                        }
+                        cases++;
+                        if (off && failed++ < 5)
+                            printf("  radius %d width %d start %d sweep %d: %d pixels more than a pixel off\n",
+                                   radius, width, start, dir * sweep, off);
+                    }
+    printf("Match: %d of %d arcs within one pixel; %.1f%% of pixels differ\n", cases - failed, cases,
+           100.0 * differ / total);
+    return failed == 0;
+}
+
+static bool checkSeams()
+{
+    HostFrame split, whole;
+    int       failed = 0;
+    srand(1);
+    for (int n = 0; n < 2000; n++)
+    {
+        // in whole angle units, which the sectors round to
+        const float unit   = arcTwoPi / ARC_TURN;
+        int         radius = 20 + rand() % 90, width = 1 + rand() % 20;
+        int32_t     start = rand() % (2 * ARC_TURN) - ARC_TURN, sweep = rand() % ARC_TURN;
+        int         parts = 1 + rand() % 5;
+
+        split.clear();
+        whole.clear();
+        fillArcSector(whole, 160, 120, radius - width / 2, radius + width / 2, start * unit, sweep * unit, 1);
+        int32_t from = start, to;
+        for (int i = 1; i <= parts; i++, from = to)
+        {
+            to = i == parts ? start + sweep : from + rand() % (start + sweep - from + 1);
+            fillArcSector(split, 160, 120, radius - width / 2, radius + width / 2, from * unit, (to - from) * unit, 1);
+        }
+        bool same = true;
+        for (size_t i = 0; i < whole.pixels.size(); i++)
+            same = same && (split.pixels[i] != 0) == (whole.pixels[i] != 0);
+        if (!same && failed++ < 5)
+            printf("  seam case %d: %d parts differ from the whole sector\n", n, parts);
+    }
+    printf("Sectors split at shared boundaries: %d of 2000 cover the whole sector's pixels\n", 2000 - failed);
+    return failed == 0;
+}
+
+struct Arc
+{
+    int16_t radius;
+    float   start, sweep;
+    uint8_t width;
+};
+
+// per frame, the fastest of a few runs so that other load on the host counts least
+template <class Fill> static double timeArcs(Fill fill, const Arc *arcs, int count, int frames)
+{
+    HostFrame frame;
+    double    best = 0;
+    for (int run = 0; run < 5; run++)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; f++)
+            for (int i = 0; i < count; i++)
+                fill(frame, 160, 120, arcs[i].radius, arcs[i].start, arcs[i].sweep, arcs[i].width, 1 + f % 2);
+        auto   end = std::chrono::steady_clock::now();
+        double us  = std::chrono::duration<double, std::micro>(end - begin).count() / frames;
+        if (run == 0 || us < best)
+            best = us;
+    }
+    return best;
+}
+
+static void bench(const char *name, const Arc *arcs, int count)
+{
+    const int frames    = 2000;
+    double    triangles = timeArcs(fillArcTriangles, arcs, count, frames);
+    double    scanline  = timeArcs(fillArcScanline, arcs, count, frames);
+    printf("%-22s triangles %7.2f us, scanline %6.2f us, %.1fx\n", name, triangles, scanline, triangles / scanline);
+}
+
+int main()
+{
+    bool ok = checkMatch();
+    ok      = checkSeams() && ok;
+
+    // drawAOA(): bottom and top onspeed arcs on the full screen page
+    const Arc aoa[] = { { 24, 0, (float)M_PI, 8 }, { 24, (float)M_PI, (float)M_PI, 8 } };
+    bench("drawAOA() arcs", aoa, 2);
+
+    // arcGraph(): five ranges over a 240 degree dial, and a full ring
+    const Arc graph[] = {
+        { 100, 150 * DEG_TO_RAD_F, 60 * DEG_TO_RAD_F, 16 }, { 100, 210 * DEG_TO_RAD_F, 40 * DEG_TO_RAD_F, 16 },
+        { 100, 250 * DEG_TO_RAD_F, 50 * DEG_TO_RAD_F, 16 }, { 100, 300 * DEG_TO_RAD_F, 60 * DEG_TO_RAD_F, 16 },
+        { 100, 360 * DEG_TO_RAD_F, 30 * DEG_TO_RAD_F, 16 }, { 60, 0, 2 * (float)M_PI, 10 },
+    };
+    bench("arcGraph() ranges", graph, 6);
+
+    printf(ok ? "ArcRaster OK\n" : "ArcRaster FAILED\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,215 @@
+/*
+  DisplayListBench.cpp - correctness and fill time of the recorded display list (DisplayList.h).
+
+  Records a synthetic attitude page as FrameSprite would (sky and ground split by a banked
+  horizon drawn as scanlines, pitch ladder lines, arc pixels, text runs), checks that filling
+  the list gives the same frame byte for byte as drawing the rectangles immediately, in an
+  8 bit and a 4 bit buffer, and times both over many frames with the horizon moving.  The
+  same list is then filled strip by strip into a buffer of FRAME_STRIP_LINES lines, as
+  FrameSprite does in strip mode, and checked against the same reference strip by strip.
+
+  Build (from this directory):
+    g++ -O2 -std=gnu++11 -I../../examples/OnSpeed_huVVer_display -o DisplayListBench DisplayListBench.cpp
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include "DisplayList.h"
+
+#define WIDTH 320
+#define HEIGHT 240
+#define LIST_SIZE 16384
+#define STRIP_LINES 32 // FRAME_STRIP_LINES
+
+struct Rect
+{
+    int32_t x, y, w, h;
+    uint8_t color;
+};
+
+// clip like FrameSprite::clip()
+static bool clip(Rect &r)
+{
+    if (r.x < 0) { r.w += r.x; r.x = 0; }
+    if (r.y < 0) { r.h += r.y; r.y = 0; }
+    if (r.x + r.w > WIDTH) r.w = WIDTH - r.x;
+    if (r.y + r.h > HEIGHT) r.h = HEIGHT - r.y;
+    return r.w > 0 && r.h > 0;
+}
+
+// one frame of the attitude page, bank in degrees and pitch in pixels
+static void buildPage(std::vector<Rect> &rects, double bank, int pitch)
+{
+    rects.clear();
+    double slope = tan(bank * M_PI / 180.0);
+
+    // sky above, ground below the horizon line, one run per line
+    for (int y = 0; y < HEIGHT; y++)
+    {
+        int split = (int)(WIDTH / 2 + (y - HEIGHT / 2 - pitch) / (slope == 0 ? 1e-6 : slope));
+        if (split < 0) split = 0;
+        if (split > WIDTH) split = WIDTH;
+        Rect sky = { 0, y, split, 1, 0x13 }, ground = { split, y, WIDTH - split, 1, 0x88 };
+        if (slope < 0)
+        {
+            sky.color    = 0x88;
+            ground.color = 0x13;
+        }
+        rects.push_back(sky);
+        rects.push_back(ground);
+    }
+
+    // pitch ladder
+    for (int step = -4; step <= 4; step++)
+    {
+        int  y    = HEIGHT / 2 + pitch + step * 20;
+        Rect line = { WIDTH / 2 - (step % 2 ? 20 : 40), y, step % 2 ? 40 : 80, 1, 0xFF };
+        rects.push_back(line);
+    }
+
+    // roll arc as pixels
+    for (int a = -60; a <= 60; a++)
+    {
+        double r     = 100;
+        Rect   pixel = { (int)(WIDTH / 2 + r * sin(a * M_PI / 180)), (int)(HEIGHT / 2 - r * cos(a * M_PI / 180)), 1, 1, 0xFF };
+        rects.push_back(pixel);
+    }
+
+    // two text boxes of short runs and single columns
+    for (int box = 0; box < 2; box++)
+    {
+        Rect back = { box ? WIDTH - 70 : 10, HEIGHT / 2 - 12, 60, 24, 0x00 };
+        rects.push_back(back);
+        for (int c = 0; c < 5; c++)
+            for (int row = 0; row < 14; row += 2)
+            {
+                Rect run = { back.x + 5 + c * 11, back.y + 5 + row, 3 + (row + c) % 5, 1, 0xFC };
+                Rect col = { back.x + 5 + c * 11, back.y + 5, 1, 14, 0xFC };
+                rects.push_back(run);
+                if (row == 0)
+                    rects.push_back(col);
+            }
+    }
+
+    // some of it off screen, dropped by the clip
+    Rect offscreen = { -20, HEIGHT - 10, 60, 30, 0xE0 };
+    rects.push_back(offscreen);
+}
+
+// 8 bit: one byte a pixel; 4 bit: the low nibble of the colour, pixel by pixel
+static void drawImmediate(const std::vector<Rect> &rects, uint8_t *frame, uint8_t bpp)
+{
+    for (size_t i = 0; i < rects.size(); i++)
+    {
+        Rect r = rects[i];
+        if (!clip(r))
+            continue;
+        for (int32_t y = r.y; y < r.y + r.h; y++)
+        {
+            if (bpp == 8)
+            {
+                memset(frame + y * WIDTH + r.x, r.color, r.w);
+                continue;
+            }
+            for (int32_t x = r.x; x < r.x + r.w; x++)
+            {
+                uint8_t &pair = frame[(y * WIDTH + x) >> 1];
+                pair = x & 1 ? (pair & 0xF0) | (r.color & 0x0F) : (pair & 0x0F) | (r.color << 4);
+            }
+        }
+    }
+}
+
+static void record(const std::vector<Rect> &rects, DisplayList &list, uint8_t bpp)
+{
+    list.clear();
+    for (size_t i = 0; i < rects.size(); i++)
+    {
+        Rect r = rects[i];
+        if (clip(r))
+            list.add(r.x, r.y, r.w, r.h, bpp == 4 ? r.color & 0x0F : r.color);
+    }
+}
+
+int main()
+{
+    const int frames = 2000;
+
+    std::vector<uint8_t> storage(LIST_SIZE);
+    std::vector<uint8_t> reference(WIDTH * HEIGHT), frame(WIDTH * HEIGHT);
+    std::vector<Rect>    rects;
+    DisplayList          list;
+    list.attach(&storage[0], LIST_SIZE);
+
+    static const uint8_t depths[] = { 8, 4 };
+    for (size_t d = 0; d < sizeof(depths); d++)
+    {
+        uint8_t  bpp    = depths[d];
+        uint32_t stride = WIDTH * bpp / 8;
+
+        // immediate mode baseline
+        double immediateNs = 0;
+        for (int f = 0; f < frames; f++)
+        {
+            buildPage(rects, 30 * sin(f / 50.0), (int)(30 * sin(f / 80.0)));
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            drawImmediate(rects, &reference[0], bpp);
+            immediateNs += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        }
+        printf("%u bit immediate: %.1f us per frame draw\n", bpp, immediateNs / frames / 1000);
+
+        // the whole list in one pass, as flushBands() fills it
+        bool   same = true;
+        double ns   = 0;
+        for (int f = 0; f < frames; f++)
+        {
+            buildPage(rects, 30 * sin(f / 50.0), (int)(30 * sin(f / 80.0)));
+            drawImmediate(rects, &reference[0], bpp);
+
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            record(rects, list, bpp);
+            replayBand(list.data, list.bytes, NULL, &frame[0], stride, bpp, 0, HEIGHT);
+            ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+            if (memcmp(&frame[0], &reference[0], stride * HEIGHT) != 0)
+                same = false;
+        }
+
+        printf("%u bit list: %u bytes, %.1f us per frame record + fill, %s immediate mode\n", bpp, list.bytes,
+               ns / frames / 1000, same ? "identical to" : "DIFFERENT from");
+        if (!same)
+            return 1;
+
+        // strip mode: the whole list once per strip, into a buffer of a few lines
+        std::vector<uint8_t> strip(stride * STRIP_LINES);
+        same = true;
+        ns   = 0;
+        for (int f = 0; f < frames; f++)
+        {
+            buildPage(rects, 30 * sin(f / 50.0), (int)(30 * sin(f / 80.0)));
+            drawImmediate(rects, &reference[0], bpp);
+
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            record(rects, list, bpp);
+            for (int32_t top = 0; top < HEIGHT; top += STRIP_LINES)
+            {
+                int32_t bottom = top + STRIP_LINES < HEIGHT ? top + STRIP_LINES : HEIGHT;
+                replayBand(list.data, list.bytes, NULL, &strip[0], stride, bpp, top, bottom, top);
+                ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+                if (memcmp(&strip[0], &reference[top * stride], (bottom - top) * stride) != 0)
+                    same = false;
+                start = std::chrono::steady_clock::now();
+            }
+        }
+
+        printf("%u bit %u line strips: %u byte buffer instead of %u, %.1f us per frame record + fill, %s immediate mode\n",
+               bpp, STRIP_LINES, stride * STRIP_LINES, stride * HEIGHT, ns / frames / 1000, same ? "identical to" : "DIFFERENT from");
+        if (!same)
+            return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,245 @@
+/*
+  DisplayListReplay.cpp - replay display lists dumped by the display, and profile their commands.
+
+  With FRAMESTATSDEBUG defined, sending 'd' on the console makes the display dump the display
+  list of the frame it is rendering (format in DisplayList.h).  Save the console output and
+  give it to this program: every list found is decoded, replayed into a frame buffer whole and
+  strip by strip (checked to match), timed as a whole and command by command, and the most
+  expensive commands are listed.  DL_LAYER copies a black static layer, the layer content is
+  not part of the dump.
+
+  Build (from this directory):
+    g++ -O2 -std=gnu++11 -I../../examples/OnSpeed_huVVer_display -o DisplayListReplay DisplayListReplay.cpp
+
+  Run:
+    ./DisplayListReplay console.log [frame.ppm]
+
+  The optional ppm file gets the last list replayed, expanded from RGB332 or the dumped palette.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "DisplayList.h"
+
+#define REPEATS 200
+#define STRIP_LINES 32 // FRAME_STRIP_LINES
+
+struct Dump
+{
+    int                  width, height, bpp;
+    bool                 partial;
+    uint16_t             palette[16];
+    std::vector<uint8_t> bytes;
+};
+
+struct CommandCost
+{
+    uint32_t offset;
+    double   ns;
+};
+
+static const char *opName(uint8_t op)
+{
+    static const char *names[] = { "?", "PIXEL", "HLINE", "VLINE", "RECT", "CLEAR", "LAYER" };
+    return op < sizeof(names) / sizeof(names[0]) ? names[op] : "?";
+}
+
+static void describe(const uint8_t *p, char *text, size_t size)
+{
+    uint8_t op = p[0];
+    if (op == DL_CLEAR)
+        snprintf(text, size, "CLEAR color %02X", p[1]);
+    else if (op == DL_LAYER)
+        snprintf(text, size, "LAYER");
+    else
+    {
+        int x = p[2] | (p[3] << 8), y = p[4], w = 1, h = 1;
+        if (op == DL_HLINE || op == DL_RECT)
+            w = p[5] | (p[6] << 8);
+        if (op == DL_VLINE)
+            h = p[5];
+        else if (op == DL_RECT)
+            h = p[7];
+        snprintf(text, size, "%-5s color %02X at %d,%d size %dx%d", opName(op), p[1], x, y, w, h);
+    }
+}
+
+static bool readDumps(FILE *file, std::vector<Dump> &dumps)
+{
+    char  line[256];
+    Dump *dump = NULL;
+
+    while (fgets(line, sizeof(line), file))
+    {
+        if (dump == NULL)
+        {
+            int      width, height, bpp;
+            unsigned bytes;
+            if (sscanf(line, "DL %d %d %d %u", &width, &height, &bpp, &bytes) == 4)
+            {
+                dumps.push_back(Dump());
+                dump          = &dumps.back();
+                dump->width   = width;
+                dump->height  = height;
+                dump->bpp     = bpp;
+                dump->partial = strstr(line, "partial") != NULL;
+                for (int i = 0; i < 16; i++)
+                    dump->palette[i] = 0;
+                dump->bytes.reserve(bytes);
+            }
+            continue;
+        }
+
+        if (strncmp(line, "PAL", 3) == 0)
+        {
+            char *p = line + 3;
+            for (int i = 0; i < 16; i++)
+                dump->palette[i] = (uint16_t)strtoul(p, &p, 16);
+            continue;
+        }
+
+        if (strncmp(line, "DL END", 6) == 0)
+        {
+            dump = NULL;
+            continue;
+        }
+        for (const char *p = line; p[0] && p[1] && p[0] != '\r' && p[0] != '\n'; p += 2)
+        {
+            char hex[3] = { p[0], p[1], 0 };
+            dump->bytes.push_back((uint8_t)strtoul(hex, NULL, 16));
+        }
+    }
+    return dump == NULL;
+}
+
+static void writePPM(const char *name, const std::vector<uint8_t> &frame, const Dump &dump)
+{
+    FILE *file = fopen(name, "wb");
+    if (file == NULL)
+        return;
+    fprintf(file, "P6\n%d %d\n255\n", dump.width, dump.height);
+    for (int i = 0; i < dump.width * dump.height; i++)
+    {
+        uint8_t rgb[3];
+        if (dump.bpp == 4)
+        {
+            uint16_t c = dump.palette[(frame[i >> 1] >> (i & 1 ? 0 : 4)) & 0x0F];
+            rgb[0]     = (uint8_t)((c >> 11) * 255 / 31);
+            rgb[1]     = (uint8_t)(((c >> 5) & 0x3F) * 255 / 63);
+            rgb[2]     = (uint8_t)((c & 0x1F) * 255 / 31);
+        }
+        else
+        {
+            uint8_t c = frame[i];
+            rgb[0]    = (uint8_t)((c >> 5) * 255 / 7);
+            rgb[1]    = (uint8_t)(((c >> 2) & 7) * 255 / 7);
+            rgb[2]    = (uint8_t)((c & 3) * 255 / 3);
+        }
+        fwrite(rgb, 1, 3, file);
+    }
+    fclose(file);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s console.log [frame.ppm]\n", argv[0]);
+        return 2;
+    }
+
+    FILE *file = fopen(argv[1], "r");
+    if (file == NULL)
+    {
+        perror(argv[1]);
+        return 2;
+    }
+    std::vector<Dump> dumps;
+    bool complete = readDumps(file, dumps);
+    fclose(file);
+    if (!complete)
+        fprintf(stderr, "last list has no DL END, replaying what was read\n");
+    if (dumps.empty())
+    {
+        fprintf(stderr, "no display list found\n");
+        return 1;
+    }
+
+    std::vector<uint8_t> frame, strips, layer;
+    for (size_t d = 0; d < dumps.size(); d++)
+    {
+        Dump       &dump   = dumps[d];
+        uint32_t    stride = dump.width * dump.bpp / 8;
+        DisplayList list;
+        list.attach(&dump.bytes[0], dump.bytes.size());
+        list.bytes = dump.bytes.size();
+
+        frame.assign(stride * dump.height, 0);
+        strips.assign(stride * dump.height, 0);
+        layer.assign(stride * dump.height, 0);
+
+        // command mix
+        uint32_t counts[8] = { 0 }, commands = 0;
+        for (uint32_t offset = 0; offset < list.bytes; offset += displayOpSize(list.data[offset]))
+        {
+            if (displayOpSize(list.data[offset]) == 0)
+            {
+                fprintf(stderr, "list %zu: bad opcode %02X at %u\n", d, list.data[offset], offset);
+                return 1;
+            }
+            counts[list.data[offset]]++;
+            commands++;
+        }
+
+        // whole list, and strip by strip as in strip mode
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int r = 0; r < REPEATS; r++)
+            replayBand(list.data, list.bytes, &layer[0], &frame[0], stride, dump.bpp, 0, dump.height);
+        double oneNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / REPEATS;
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < REPEATS; r++)
+            for (int32_t top = 0; top < dump.height; top += STRIP_LINES)
+                replayBand(list.data, list.bytes, &layer[0], &strips[0], stride, dump.bpp, top,
+                           top + STRIP_LINES < dump.height ? top + STRIP_LINES : dump.height);
+        double stripNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / REPEATS;
+
+        // every command on its own
+        std::vector<CommandCost> costs;
+        for (uint32_t offset = 0; offset < list.bytes; offset += displayOpSize(list.data[offset]))
+        {
+            uint8_t size = displayOpSize(list.data[offset]);
+            start        = std::chrono::steady_clock::now();
+            for (int r = 0; r < REPEATS; r++)
+                replayBand(list.data + offset, size, &layer[0], &frame[0], stride, dump.bpp, 0, dump.height);
+            CommandCost cost = { offset, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / REPEATS };
+            costs.push_back(cost);
+        }
+        std::sort(costs.begin(), costs.end(), [](const CommandCost &a, const CommandCost &b) { return a.ns > b.ns; });
+
+        printf("list %zu: %dx%d %d bit, %u bytes, %u commands%s\n", d, dump.width, dump.height, dump.bpp, list.bytes, commands,
+               dump.partial ? " (end of a frame only)" : "");
+        printf("  mix:");
+        for (uint8_t op = DL_PIXEL; op <= DL_LAYER; op++)
+            printf(" %s %u", opName(op), counts[op]);
+        printf("\n  replay: %.1f us whole, %.1f us in %u line strips, %s\n", oneNs / 1000, stripNs / 1000, STRIP_LINES,
+               frame == strips ? "identical" : "DIFFERENT");
+        printf("  most expensive commands:\n");
+        for (size_t i = 0; i < costs.size() && i < 10; i++)
+        {
+            char text[64];
+            describe(list.data + costs[i].offset, text, sizeof(text));
+            printf("    %8.2f us  @%-6u %s\n", costs[i].ns / 1000, costs[i].offset, text);
+        }
+        if (frame != strips)
+            return 1;
+    }
+
+    if (argc > 2)
+        writePPM(argv[2], frame, dumps.back());
+    return 0;
+}
@@ -0,0 +1,110 @@
+/*
+  EnergyRateBench.cpp - per-frame cost and accuracy of the fixed point Ps channel (EnergyRate.h).
+
+  Feeds a synthetic 10 Hz flight (climbs, descents, accelerations, turns at varying altitude
+  and OAT) through EnergyRate, times the update, and compares Ps and TAS against a double
+  precision reference that uses the same smoothing.
+
+  Build (from this directory):
+    g++ -O2 -std=gnu++11 -I../../examples/OnSpeed_huVVer_display -o EnergyRateBench EnergyRateBench.cpp
+*/
+
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include "EnergyRate.h"
+
+#define FRAMES_PER_SECOND 10
+
+struct Frame
+{
+    float ias, vsi, palt;
+    int   oat;
+};
+
+// double precision reference with the same derivative smoothing
+struct Reference
+{
+    double lastIAS, dIAS;
+    bool   primed;
+
+    Reference() : lastIAS(0), dIAS(0), primed(false) {}
+
+    void update(const Frame &f, double &ps, double &tas)
+    {
+        if (!primed)
+        {
+            lastIAS = f.ias;
+            primed  = true;
+        }
+        dIAS   += ((f.ias - lastIAS) - dIAS) / (1 << PS_SMOOTHING_SHIFT);
+        lastIAS = f.ias;
+
+        double h     = f.palt;
+        double delta = h <= 36089 ? pow(1 - 6.8755856e-6 * h, 5.2558797) : 0.2233609 * exp(-4.806346e-5 * (h - 36089));
+        double theta = (f.oat + 273.0) / 288.0;
+        double ratio = sqrt(theta / delta);
+
+        tas = f.ias * ratio;
+        double dTAS = dIAS * FRAMES_PER_SECOND * ratio;                // kts/s
+        ps  = tas * 1.68781 * dTAS * 1.68781 / 32.174 * 60.0 + f.vsi;  // fpm
+        if (ps > PS_LIMIT) ps = PS_LIMIT;
+        if (ps < -PS_LIMIT) ps = -PS_LIMIT;
+    }
+};
+
+int main()
+{
+    // one hour of flight with a mix of manoeuvres
+    std::vector<Frame> flight;
+    for (int i = 0; i < 3600 * FRAMES_PER_SECOND; i++)
+    {
+        double t    = (double)i / FRAMES_PER_SECOND;
+        Frame  f;
+        f.ias  = (float)(110 + 40 * sin(t / 37) + 8 * sin(t / 5.3) + 0.3 * sin(t * 7.1)); // slow cycles plus jitter
+        f.vsi  = (float)(1200 * sin(t / 61) + 300 * sin(t / 9));
+        f.palt = (float)(9000 + 8500 * sin(t / 700));
+        f.oat  = (int)(15 - 2 * f.palt / 1000 + 5 * sin(t / 1300));
+        flight.push_back(f);
+    }
+
+    EnergyRate energy(FRAMES_PER_SECOND);
+    Reference  reference;
+    double     maxPsError = 0, sumPsError = 0, maxTasError = 0;
+
+    for (size_t i = 0; i < flight.size(); i++)
+    {
+        double ps, tas;
+        energy.update(flight[i].ias, flight[i].vsi, flight[i].palt, flight[i].oat);
+        reference.update(flight[i], ps, tas);
+
+        double psError  = fabs(energy.psFpm - ps);
+        double tasError = fabs(energy.tasKts - tas);
+        sumPsError += psError;
+        if (psError > maxPsError)
+            maxPsError = psError;
+        if (tasError > maxTasError)
+            maxTasError = tasError;
+    }
+
+    // timing: repeat the flight enough times to get a stable figure
+    const int repeats = 50;
+    volatile int32_t sink = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++)
+    {
+        energy.reset();
+        for (size_t i = 0; i < flight.size(); i++)
+        {
+            energy.update(flight[i].ias, flight[i].vsi, flight[i].palt, flight[i].oat);
+            sink += energy.psFpm;
+        }
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%zu frames x %d: %.1f ns per frame update\n", flight.size(), repeats, ns / (flight.size() * repeats));
+    printf("Ps error vs double reference: mean %.2f fpm, max %.2f fpm\n", sumPsError / flight.size(), maxPsError);
+    printf("TAS error vs double reference: max %.2f kts (integer kts output)\n", maxTasError);
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+  FastTrigBench.cpp - accuracy and speed of the sine table (FastTrig.h).
+
+  Checks trigSin() and trigCos() over every angle unit against the sine and cosine in double
+  precision, and fastSin() and fastCos() over a million float angles in radians, against the
+  bounds given in FastTrig.h.  Then times fastSinCos() against sinf() and cosf().
+
+  Build (from this directory):
+    g++ -O2 -std=gnu++11 -I../.. -o FastTrigBench FastTrigBench.cpp
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "FastTrig.h"
+
+#define TABLE_BOUND 5.1e-5 // trigSin(), trigCos()
+#define FLOAT_BOUND 1.0e-4 // fastSin(), fastCos(), with the angle rounded to a unit
+
+int main()
+{
+    bool   ok       = true;
+    double tableMax = 0;
+    for (int32_t a = 0; a < TRIG_TURN; a++)
+    {
+        double radians = a * (2 * M_PI / TRIG_TURN);
+        double s       = fabs(trigSin(a) / (double)TRIG_ONE - sin(radians));
+        double c       = fabs(trigCos(a) / (double)TRIG_ONE - cos(radians));
+        tableMax       = s > tableMax ? s : tableMax;
+        tableMax       = c > tableMax ? c : tableMax;
+    }
+    printf("trigSin/trigCos: largest error %.2e over all %d angles, bound %.1e, %u table bytes\n", tableMax, TRIG_TURN,
+           TABLE_BOUND, (unsigned)sizeof(TrigQuarter::sine));
+    ok = tableMax <= TABLE_BOUND;
+
+    const int count = 1000000;
+    float    *angles = new float[count];
+    srand(1);
+    for (int i = 0; i < count; i++)
+        angles[i] = (rand() / (float)RAND_MAX - 0.5f) * 8 * (float)M_PI;
+
+    double floatMax = 0;
+    for (int i = 0; i < count; i++)
+    {
+        double s = fabs(fastSin(angles[i]) - sin((double)angles[i]));
+        double c = fabs(fastCos(angles[i]) - cos((double)angles[i]));
+        floatMax = s > floatMax ? s : floatMax;
+        floatMax = c > floatMax ? c : floatMax;
+    }
+    printf("fastSin/fastCos: largest error %.2e over %d angles within +-4 pi, bound %.1e\n", floatMax, count,
+           FLOAT_BOUND);
+    ok = floatMax <= FLOAT_BOUND && ok;
+
+    // the sums keep the compiler from dropping the loops
+    volatile float sink = 0;
+    float          sum  = 0;
+    auto           start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        float s, c;
+        fastSinCos(angles[i], s, c);
+        sum += s + c;
+    }
+    double tableNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count;
+    sink           = sum;
+
+    sum   = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+        sum += sinf(angles[i]) + cosf(angles[i]);
+    double libmNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count;
+    sink          = sum;
+    (void)sink;
+
+    printf("sine and cosine of one angle: %.1f ns from the table, %.1f ns from sinf() and cosf()\n", tableNs, libmNs);
+    delete[] angles;
+
+    printf(ok ? "FastTrig OK\n" : "FastTrig FAILED\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+/*
+  PushConvertBench.cpp - correctness and throughput of the DMA push pixel conversion (PixelConvert.h).
+
+  Converts a frame of random 8 bit and 4 bit pixels to byte swapped RGB565 the way FrameSprite
+  did before, one 16 bit store per pixel, and with the 32 bit packed conversion, both for full
+  lines and for windows one tile wide, checks that the output is the same, and prints the
+  throughput of each in pixels per microsecond.  On the display, FRAMESTATSDEBUG reports the
+  same figure for the last DMA push.
+
+  Build (from this directory):
+    g++ -O2 -std=gnu++11 -pthread -I../../examples/OnSpeed_huVVer_display -o PushConvertBench PushConvertBench.cpp
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "PixelConvert.h"
+
+#define WIDTH 320
+#define HEIGHT 240
+#define TILE 16 // FRAME_TILE_SIZE
+#define FRAMES 500
+
+// TFT_eSPI::color8to16()
+static uint16_t color8to16(uint8_t color)
+{
+    static const uint8_t blue[] = { 0, 11, 21, 31 };
+    uint16_t color16 = (color & 0x1C) << 6 | (color & 0xC0) << 5 | (color & 0xE0) << 8;
+    return color16 | (color & 0x1C) << 3 | blue[color & 0x03];
+}
+
+// the conversion FrameSprite::sendRect() used before
+static void convertPixels(const uint8_t *frame, uint16_t *out, const uint16_t *table, uint8_t bpp, int x, int w)
+{
+    uint32_t stride = WIDTH * bpp / 8;
+    for (int y = 0; y < HEIGHT; y++)
+    {
+        const uint8_t *line = frame + y * stride + x * bpp / 8;
+        if (bpp == 4)
+        {
+            for (int i = 0; i < w >> 1; i++)
+            {
+                *out++ = table[line[i] >> 4];
+                *out++ = table[line[i] & 0x0F];
+            }
+        }
+        else
+        {
+            for (int i = 0; i < w; i++)
+                *out++ = table[line[i]];
+        }
+    }
+}
+
+static void convertPacked(const uint8_t *frame, uint32_t *out, const uint16_t *table, const uint32_t *pairs, uint8_t bpp,
+                          int x, int w)
+{
+    uint32_t stride = WIDTH * bpp / 8;
+    for (int y = 0; y < HEIGHT; y++)
+    {
+        const uint8_t *line = frame + y * stride + x * bpp / 8;
+        if (bpp == 4)
+            convertLine4(line, out, pairs, w >> 1);
+        else
+            convertLine8(line, out, table, w);
+        out += w >> 1;
+    }
+}
+
+int main()
+{
+    uint16_t table[256];
+    uint32_t pairs[256];
+    for (int i = 0; i < 256; i++)
+    {
+        uint16_t color = color8to16(i);
+        table[i]       = (color >> 8) | (color << 8);
+    }
+    buildPairTable(table, pairs);
+
+    std::vector<uint8_t>  frame(WIDTH * HEIGHT);
+    std::vector<uint16_t> reference(WIDTH * HEIGHT);
+    std::vector<uint32_t> packed(WIDTH * HEIGHT / 2);
+    srand(1);
+    for (size_t i = 0; i < frame.size(); i++)
+        frame[i] = rand();
+
+    static const uint8_t depths[] = { 8, 4 };
+    static const int     widths[] = { WIDTH, TILE };
+    for (size_t d = 0; d < sizeof(depths); d++)
+    {
+        for (size_t k = 0; k < sizeof(widths) / sizeof(widths[0]); k++)
+        {
+            uint8_t bpp     = depths[d];
+            int     w       = widths[k];
+            int     windows = WIDTH / w;
+            double  pixels  = (double)WIDTH * HEIGHT * FRAMES;
+
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int f = 0; f < FRAMES; f++)
+                for (int x = 0; x < WIDTH; x += w)
+                    convertPixels(&frame[0], &reference[(x / w) * w * HEIGHT], table, bpp, x, w);
+            double pixelNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+            start = std::chrono::steady_clock::now();
+            for (int f = 0; f < FRAMES; f++)
+                for (int x = 0; x < WIDTH; x += w)
+                    convertPacked(&frame[0], &packed[(x / w) * w * HEIGHT / 2], table, pairs, bpp, x, w);
+            double packedNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+            bool same = memcmp(&reference[0], &packed[0], WIDTH * HEIGHT * sizeof(uint16_t)) == 0;
+            printf("%u bit, %3d px windows x %2d: pixel by pixel %.0f px/us, packed %.0f px/us (%.2fx), %s\n", bpp, w, windows,
+                   pixels / (pixelNs / 1000), pixels / (packedNs / 1000), pixelNs / packedNs, same ? "identical" : "DIFFERENT");
+            if (!same)
+                return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,171 @@
+/*
+  ToneGenWav.cpp - render a recorded OnSpeed serial log to a WAV file with the display's tone generator.
+
+  Reads "#1" OnSpeed protocol lines (as captured from the display serial input, 10 Hz),
+  smooths AOA with aoaSmoothingAlpha as SerialProcess() does, feeds it with IAS and the tone
+  setpoints to ToneSynth like the sketch's toneUpdate(SmoothedAOA, ...) and writes a 16 bit
+  mono WAV at TONE_SAMPLE_RATE.  Reports CPU time per TONE_BUFFER_LEN buffer and prints
+  every tone change so the timing can be checked against the recorded flight.
+
+  Build (from this directory):
+    g++ -O2 -std=gnu++11 -I../../examples/OnSpeed_huVVer_display -o ToneGenWav \
+        ToneGenWav.cpp ../../examples/OnSpeed_huVVer_display/ToneGen.cpp
+
+  Usage:
+    ./ToneGenWav flight.log flight.wav [-q]     (-q: no tone change listing)
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "ToneGen.h"
+
+#define RECORD_MS 100             // OnSpeed serial stream rate
+#define AOA_SMOOTHING_ALPHA 0.7f  // aoaSmoothingAlpha, OnSpeed_huVVer_display.ino
+
+struct Record
+{
+    float aoa, ias, stallWarnAOA, slowAOA, fastAOA, tonesOnAOA; // aoa smoothed once all are read
+};
+
+static float field(const char *line, int start, int end, float scale)
+{
+    char buf[16];
+    int  len = end - start;
+    memcpy(buf, line + start, len);
+    buf[len] = 0;
+    return (float)atof(buf) / scale;
+}
+
+// same columns and CRC as SerialRead()
+static bool parseLine(const char *line, Record &record)
+{
+    if (strlen(line) < 78 || line[0] != '#' || line[1] != '1')
+        return false;
+
+    int calcCRC = 0;
+    for (int i = 0; i <= 75; i++)
+        calcCRC += line[i];
+    char crc[3] = { line[76], line[77], 0 };
+    if ((calcCRC & 0xFF) != (int)strtol(crc, NULL, 16))
+        return false;
+
+    record.ias          = field(line, 11, 15, 10);
+    record.aoa          = field(line, 34, 38, 10);
+    record.stallWarnAOA = field(line, 52, 56, 10);
+    record.slowAOA      = field(line, 56, 60, 10);
+    record.fastAOA      = field(line, 60, 64, 10);
+    record.tonesOnAOA   = field(line, 64, 68, 10);
+    if (record.aoa == -100)
+        record.aoa = 0;
+    return true;
+}
+
+static void put16(FILE *f, uint16_t v) { fputc(v & 0xFF, f); fputc(v >> 8, f); }
+static void put32(FILE *f, uint32_t v) { put16(f, v & 0xFFFF); put16(f, v >> 16); }
+
+static void writeWav(FILE *f, const std::vector<int16_t> &samples)
+{
+    uint32_t dataBytes = samples.size() * 2;
+    fwrite("RIFF", 1, 4, f); put32(f, 36 + dataBytes);
+    fwrite("WAVEfmt ", 1, 8, f); put32(f, 16);
+    put16(f, 1); put16(f, 1);                                  // PCM, mono
+    put32(f, TONE_SAMPLE_RATE); put32(f, TONE_SAMPLE_RATE * 2);
+    put16(f, 2); put16(f, 16);
+    fwrite("data", 1, 4, f); put32(f, dataBytes);
+    for (size_t i = 0; i < samples.size(); i++)
+        put16(f, (uint16_t)samples[i]);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s flight.log out.wav [-q]\n", argv[0]);
+        return 1;
+    }
+    bool quiet = argc > 3 && strcmp(argv[3], "-q") == 0;
+
+    FILE *in = fopen(argv[1], "r");
+    if (!in)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    std::vector<Record> records;
+    char line[256];
+    int  rejected = 0;
+    while (fgets(line, sizeof(line), in))
+    {
+        Record record;
+        if (parseLine(line, record))
+            records.push_back(record);
+        else
+            rejected++;
+    }
+    fclose(in);
+    if (records.empty())
+    {
+        fprintf(stderr, "no valid #1 records in %s\n", argv[1]);
+        return 1;
+    }
+
+    // SmoothedAOA, from 0 at boot like the sketch's
+    float smoothedAOA = 0;
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        smoothedAOA    = smoothedAOA * AOA_SMOOTHING_ALPHA + (1 - AOA_SMOOTHING_ALPHA) * records[i].aoa;
+        records[i].aoa = smoothedAOA;
+    }
+
+    ToneSynth            synth;
+    std::vector<int16_t> samples;
+    int16_t              buffer[TONE_BUFFER_LEN];
+    uint32_t totalSamples  = (uint32_t)((uint64_t)records.size() * RECORD_MS * TONE_SAMPLE_RATE / 1000);
+    double   worstMicros   = 0, totalMicros = 0;
+    uint32_t buffers       = 0;
+    uint16_t lastFrequency = 0xFFFF;
+    float    lastRate      = -1;
+
+    for (uint32_t n = 0; n < totalSamples; n += TONE_BUFFER_LEN)
+    {
+        // the tone task picks up the latest serial record at each buffer start
+        const Record &r = records[(uint64_t)n * 1000 / TONE_SAMPLE_RATE / RECORD_MS];
+        synth.setAOA(r.aoa, r.ias, r.tonesOnAOA, r.fastAOA, r.slowAOA, r.stallWarnAOA);
+
+        if (!quiet && (synth.toneFrequency != lastFrequency || (int)(synth.pulseRate * 10) != (int)(lastRate * 10)))
+        {
+            printf("%9.3f s  AOA %5.1f  %4u Hz  %s %.1f pps\n", (double)n / TONE_SAMPLE_RATE, r.aoa, synth.toneFrequency,
+                   synth.pulseRate == 0 ? "solid" : "pulse", synth.pulseRate);
+            lastFrequency = synth.toneFrequency;
+            lastRate      = synth.pulseRate;
+        }
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        synth.render(buffer, TONE_BUFFER_LEN);
+        double micros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        totalMicros += micros;
+        if (micros > worstMicros)
+            worstMicros = micros;
+        buffers++;
+        samples.insert(samples.end(), buffer, buffer + TONE_BUFFER_LEN);
+    }
+
+    FILE *out = fopen(argv[2], "wb");
+    if (!out)
+    {
+        perror(argv[2]);
+        return 1;
+    }
+    writeWav(out, samples);
+    fclose(out);
+
+    printf("%zu records (%d lines rejected), %.1f s of audio\n", records.size(), rejected, (double)samples.size() / TONE_SAMPLE_RATE);
+    printf("CPU per %d sample buffer (%.1f ms of audio): mean %.2f us, worst %.2f us\n", TONE_BUFFER_LEN,
+           1000.0 * TONE_BUFFER_LEN / TONE_SAMPLE_RATE, totalMicros / buffers, worstMicros);
+    return 0;
+}